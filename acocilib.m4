@@ -125,6 +125,42 @@ AC_DEFUN([OCILIB_OPTIONS],
 ])
 
 
+dnl ------------------------------------------------------------------------
+dnl OCILIB_PTHREAD()
+dnl ------------------------------------------------------------------------
+dnl
+AC_DEFUN([OCILIB_PTHREAD],
+[
+  PTHREAD_CFLAGS=""
+  PTHREAD_LIBS=""
+
+  ac_ocilib_save_CFLAGS=$CFLAGS
+  ac_ocilib_save_LIBS=$LIBS
+
+  AC_MSG_CHECKING([whether the compiler accepts -pthread])
+
+  CFLAGS="$CFLAGS -pthread"
+
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([[#include <pthread.h>]],
+                                  [[pthread_rwlock_t lock; return pthread_rwlock_init(&lock, 0);]])],
+                 [ PTHREAD_CFLAGS="-pthread"
+                   AC_MSG_RESULT([yes]) ],
+                 [ AC_MSG_RESULT([no]) ])
+
+  AC_SEARCH_LIBS([pthread_rwlock_init], [pthread],
+                 [ if test "$ac_cv_search_pthread_rwlock_init" != "none required"; then
+                     PTHREAD_LIBS=$ac_cv_search_pthread_rwlock_init
+                   fi ],
+                 [ AC_MSG_WARN([POSIX reader/writer locks not found]) ])
+
+  CFLAGS=$ac_ocilib_save_CFLAGS
+  LIBS=$ac_ocilib_save_LIBS
+
+  AC_SUBST(PTHREAD_CFLAGS)
+  AC_SUBST(PTHREAD_LIBS)
+])
+
+
 dnl ------------------------------------------------------------------------
 dnl OCILIB_ORACLE()
 dnl ------------------------------------------------------------------------
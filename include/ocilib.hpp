@@ -162,7 +162,9 @@ namespace ocilib
 #include "ocilibcpp/detail/core/Locker.hpp"
 #include "ocilibcpp/detail/core/Lockable.hpp"
 #include "ocilibcpp/detail/core/ConcurrentMap.hpp"
+#include "ocilibcpp/detail/core/ConcurrentHashMap.hpp"
 #include "ocilibcpp/detail/core/ConcurrentList.hpp"
+#include "ocilibcpp/detail/core/HandleList.hpp"
 #include "ocilibcpp/detail/core/SmartHandle.hpp"
 #include "ocilibcpp/detail/core/MemoryDebugInfo.hpp"
 
@@ -175,6 +177,7 @@ namespace ocilib
 #include "ocilibcpp/detail/support/BindTypeAdaptor.hpp"
 #include "ocilibcpp/detail/support/BindsHolder.hpp"
 #include "ocilibcpp/detail/support/NumericTypeResolver.hpp"
+#include "ocilibcpp/detail/support/LobStreamBuffer.hpp"
 
 /* Including types implementations  */
 
@@ -184,6 +187,7 @@ namespace ocilib
 #include "ocilibcpp/detail/Thread.hpp"
 #include "ocilibcpp/detail/ThreadKey.hpp"
 #include "ocilibcpp/detail/Pool.hpp"
+#include "ocilibcpp/detail/PoolRouter.hpp"
 #include "ocilibcpp/detail/Connection.hpp"
 #include "ocilibcpp/detail/Transaction.hpp"
 #include "ocilibcpp/detail/Number.hpp"
@@ -210,6 +214,7 @@ namespace ocilib
 #include "ocilibcpp/detail/Enqueue.hpp"
 #include "ocilibcpp/detail/Dequeue.hpp"
 #include "ocilibcpp/detail/DirectPath.hpp"
+#include "ocilibcpp/detail/DirectPathLoader.hpp"
 #include "ocilibcpp/detail/Queue.hpp"
 #include "ocilibcpp/detail/QueueTable.hpp"
 
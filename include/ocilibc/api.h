@@ -80,10 +80,18 @@
  * - OCI_ENV_THREADED : multi-threading support
  * - OCI_ENV_CONTEXT  : thread contextual error handling
  * - OCI_ENV_EVENTS   : enables events for subscription, HA Events, AQ notifications
+ * - OCI_ENV_LAZY_BINDING : resolves OCI symbols on first use of their features
  *
  * @note
  * This function must be called before any OCILIB library function.
  *
+ * @note
+ * OCI_ENV_LAZY_BINDING is only relevant when OCILIB has been built with the option OCI_IMPORT_RUNTIME.
+ * Only the core OCI symbols are then resolved by OCI_Initialize(). The symbols related to lobs, files,
+ * timestamps, intervals, collections, pools, direct path loading, queues, notifications and database
+ * startup/shutdown are resolved the first time such features are used.
+ * It reduces the initialization time of short lived programs using a few features only.
+ *
  * @warning
  * - The parameter 'libpath' is only used if OCILIB has been built with the option OCI_IMPORT_RUNTIME
  * - If the parameter 'lib_path' is NULL, the Oracle library is loaded from system environment variables
@@ -215,6 +223,37 @@ OCI_EXPORT big_uint OCI_API OCI_GetAllocatedBytes
     unsigned int mem_type
 );
 
+/**
+ * @brief
+ * Retrieve the library initialization timings
+ *
+ * @param stats - Pointer to a structure receiving the timings
+ *
+ * @note
+ * Durations are expressed in microseconds:
+ * - setup_time       : environment variables and default formats setup
+ * - library_time     : loading of the Oracle shared library (OCI_IMPORT_RUNTIME only)
+ * - symbols_time     : resolution of OCI symbols by OCI_Initialize() (OCI_IMPORT_RUNTIME only)
+ * - environment_time : creation of the OCI environment
+ * - objects_time     : creation of internal objects (thread support, mutexes, lists)
+ * - total_time       : whole OCI_Initialize() call
+ * - lazy_time        : cumulated resolution time of symbols resolved after OCI_Initialize()
+ *
+ * @note
+ * Counters:
+ * - symbols_count : number of OCI symbols resolved by OCI_Initialize()
+ * - lazy_count    : number of OCI symbols resolved later on first use (OCI_ENV_LAZY_BINDING only)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetInitStatistics
+(
+    OCI_InitStatistics *stats
+);
+
 /**
  * @brief
  * Enable or disable Oracle warning notifications
@@ -559,6 +598,55 @@ OCI_EXPORT OCI_Connection * OCI_API OCI_ConnectionCreate
     unsigned int mode
 );
 
+/**
+ * @brief
+ * Create several physical connections to an Oracle database server concurrently
+ *
+ * @param db    - Oracle Service Name
+ * @param user  - Oracle User name
+ * @param pwd   - Oracle User password
+ * @param mode  - Session mode
+ * @param cons  - Array of connection handles to fill
+ * @param codes - Array of error codes to fill (optional)
+ * @param count - Number of connections to create
+ *
+ * @note
+ * The parameters 'db', 'user', 'pwd' and 'mode' have the same meaning as for
+ * OCI_ConnectionCreate().
+ *
+ * @note
+ * When OCILIB is initialized with OCI_ENV_THREADED, connections are established
+ * concurrently by internal threads (at most 32). Otherwise, they are established one
+ * after the other.
+ *
+ * @note
+ * The arrays 'cons' and 'codes' must have at least 'count' elements.
+ * On return, each element of 'cons' holds the connection created for that slot or NULL
+ * if it could not be established. In that case, the matching element of 'codes' holds
+ * the Oracle or OCILIB error code that has been raised, or -1 if it is unknown, and
+ * 0 otherwise.
+ *
+ * @note
+ * A failure to establish a given connection is reported only through 'codes' and does
+ * not set the last error of the calling thread. The error handler, if any, is called from
+ * the thread that tried to establish the connection.
+ *
+ * @return
+ * Number of connections established
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_ConnectionCreateMany
+(
+    const otext *    db,
+    const otext *    user,
+    const otext *    pwd,
+    unsigned int     mode,
+    OCI_Connection **cons,
+    int *            codes,
+    unsigned int     count
+);
+
 /**
  * @brief
  * Close a physical connection to an Oracle database server
@@ -770,6 +858,11 @@ OCI_EXPORT unsigned int OCI_API OCI_GetSessionMode
  *
  * @param con - Connection handle
  *
+ * @note
+ * The server version is retrieved from the server on first use only.
+ * Connections retrieved from a pool share the value retrieved by the first one.
+ * The same applies to OCI_GetDBName(), OCI_GetServiceName() and OCI_GetDomainName().
+ *
  */
 
 OCI_EXPORT const otext * OCI_API OCI_GetVersionServer
@@ -1316,6 +1409,145 @@ OCI_EXPORT boolean OCI_API OCI_SetStatementCacheSize
     unsigned int    value
 );
 
+/**
+ * @brief
+ * Return the maximum number of statements kept by the OCILIB prepared statements cache
+ *
+ * @param con  - Connection handle
+ *
+ * @note
+ * The prepared statements cache is used by OCI_StatementAcquire() and OCI_StatementRelease().
+ * Unlike the OCI statement cache, it keeps the OCILIB statement objects alive with their
+ * binds and their resultset defines.
+ *
+ * @note
+ * Default value is 20
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetPreparedCacheSize
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Set the maximum number of statements kept by the OCILIB prepared statements cache
+ *
+ * @param con   - Connection handle
+ * @param value - maximum number of statements in the cache
+ *
+ * @note
+ * If the cache holds more statements than the new size, the least recently used ones are freed.
+ * Setting the size to 0 disables the cache.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+);
+
+/**
+ * @brief
+ * Return the number of OCI_StatementAcquire() calls served from the prepared statements cache
+ *
+ * @param con  - Connection handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetPreparedCacheHits
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return the number of OCI_StatementAcquire() calls that had to prepare a new statement
+ *
+ * @param con  - Connection handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetPreparedCacheMisses
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return the maximum number of temporary lobs kept by the connection for reuse
+ *
+ * @param con  - Connection handle
+ *
+ * @note
+ * Default value is 0 (temporary lobs are not recycled)
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetTemporaryLobCacheSize
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Set the maximum number of temporary lobs kept by the connection for reuse
+ *
+ * @param con   - Connection handle
+ * @param value - maximum number of lobs in the cache
+ *
+ * @note
+ * When the cache is enabled, temporary lobs created with OCI_LobCreate() and freed with
+ * OCI_LobFree() are trimmed to an empty content and kept by the connection instead of
+ * being freed on the server. OCI_LobCreate() then returns a cached lob of the requested
+ * type if any, saving the server round trips of temporary lobs creation and release.
+ *
+ * @note
+ * If the cache holds more lobs than the new size, the extra ones are freed.
+ * Setting the size to 0 disables the cache.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetTemporaryLobCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+);
+
+/**
+ * @brief
+ * Return the number of OCI_LobCreate() calls served from the temporary lobs cache
+ *
+ * @param con  - Connection handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetTemporaryLobCacheHits
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return the number of OCI_LobCreate() calls that had to create a new temporary lob
+ *
+ * @param con  - Connection handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetTemporaryLobCacheMisses
+(
+    OCI_Connection *con
+);
+
 /**
  * @brief
  * Return the default LOB prefetch buffer size for the connection
@@ -1496,6 +1728,9 @@ OCI_EXPORT OCI_Pool * OCI_API OCI_PoolCreate
  *
  * @param pool - Pool handle
  *
+ * @note
+ * A pool added to a pool router is owned by the router and cannot be freed with this call.
+ *
  * @return
  * TRUE on success otherwise FALSE
  *
@@ -1724,123 +1959,463 @@ OCI_EXPORT boolean OCI_API OCI_PoolSetStatementCacheSize
 );
 
 /**
- * @} OcilibCApiPools
+ * @brief
+ * Retrieve a snapshot of the pool checkout statistics
+ *
+ * @param pool  - Pool handle
+ * @param stats - Pointer to the structure to fill
+ *
+ * @note
+ * Statistics are collected by OCI_PoolGetConnection() since the pool creation
+ * or the last call to OCI_PoolResetStatistics():
+ * - checkouts          : number of connections successfully retrieved
+ * - failures           : number of failed attempts, timeouts included
+ * - timeouts           : number of attempts that failed because no session became available
+ *                        in time (see OCI_PoolSetTimeout()) or immediately in no wait mode
+ * - waits              : number of attempts that found no idle session in the pool
+ * - sessions_created   : number of connections/sessions opened by the pool
+ * - sessions_destroyed : number of connections/sessions closed by the pool
+ * - tag_hits           : number of tagged requests served by a session with the requested tag
+ * - tag_misses         : number of tagged requests served by an untagged session
+ * - latency_total      : cumulated checkout time, in microseconds
+ * - latency_max        : longest checkout time, in microseconds
+ * - latency_histogram  : number of checkouts per latency range, with upper bounds of
+ *                        100us, 500us, 1ms, 5ms, 10ms, 50ms, 100ms, 500ms, 1s, 5s and 10s,
+ *                        the last entry counting checkouts longer than 10s
+ *
+ * @note
+ * OCI does not notify pool growth or shrinkage. Thus sessions_created and sessions_destroyed
+ * are computed from the variations of OCI_PoolGetOpenedCount() observed at each checkout and
+ * at each call to this function.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
  */
 
+OCI_EXPORT boolean OCI_API OCI_PoolGetStatistics
+(
+    OCI_Pool *          pool,
+    OCI_PoolStatistics *stats
+);
+
 /**
- * @defgroup OcilibCApiTransactions Managing transactions
- * @{
+ * @brief
+ * Reset the pool checkout statistics
  *
- * OCILIB supports local and global transactions.
+ * @param pool - Pool handle
  *
- * Local transactions are implicit within connection objects and there is no
- * specific call or programming step for using it.
+ * @return
+ * TRUE on success otherwise FALSE
  *
- * In order to control changes made in the database:
+ */
+
+OCI_EXPORT boolean OCI_API OCI_PoolResetStatistics
+(
+    OCI_Pool *pool
+);
+
+/**
+ * @brief
+ * Start or update the pool health keeper
  *
- * - OCI_Commit() validates current pending modifications
- * - OCI_Rollback() discards current pending modifications
+ * @param pool     - Pool handle
+ * @param target   - Number of connections/sessions to keep opened
+ * @param interval - Delay in seconds between two maintenance runs
  *
- * OCILIB supports a feature called 'Auto Commit' that performs an implicit and
- * automatic commit call after every execute call
+ * @note
+ * The health keeper is a background thread that periodically:
+ * - raises the target size to the highest number of busy sessions observed since its
+ *   previous run plus the pool increment, in order to open sessions ahead of demand
+ * - makes OCI keep the target number of sessions opened, by raising the pool minimum
+ *   size, so that the pool is warmed up before requests arrive
+ * - checks idle sessions with a server round trip, one at a time, each being handed
+ *   back to the pool before the next one is retrieved, and removes broken ones
  *
  * @note
- * Those actions are executed within a connection context and not directly to a transaction.
+ * The target size is bounded by OCI_PoolGetMax(). Idle sessions above the target
+ * size are still closed by OCI once the timeout set with OCI_PoolSetTimeout() has
+ * elapsed. The pool minimum size given to OCI_PoolCreate() is restored when the
+ * keeper is stopped and is the one still returned by OCI_PoolGetMin().
  *
- * @warning
- * Global transactions are optional and are designed for distributed or global
- * transaction environments.
+ * @note
+ * The keeper only applies to session pools. Connection pools hand out new sessions
+ * over their physical connections, so there is nothing to warm up or to check and
+ * the keeper does nothing for them.
  *
- * OCILIB supports them by :
+ * @note
+ * If the keeper is already running, its settings are updated.
+ * The keeper is stopped by OCI_PoolStopKeeper(), OCI_PoolFree() or OCI_Cleanup().
  *
- * - Creating/Destroying explicitly a transaction object
- * - Starting/Stopping/Resuming explicitly the transaction
- * - Preparing the transaction for specific calls
+ * @warning
+ * OCILIB must be initialized with OCI_ENV_THREADED.
+ * Sessions validation requires Oracle Client 10gR2 or above
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
+OCI_EXPORT boolean OCI_API OCI_PoolStartKeeper
+(
+    OCI_Pool *   pool,
+    unsigned int target,
+    unsigned int interval
+);
+
 /**
  * @brief
- * Commit current pending changes
+ * Stop the pool health keeper
  *
- * @param con - Connection handle
+ * @param pool - Pool handle
+ *
+ * @note
+ * Waits for the completion of any maintenance run in progress.
+ * Does nothing if the keeper is not running
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_Commit
+OCI_EXPORT boolean OCI_API OCI_PoolStopKeeper
 (
-    OCI_Connection *con
+    OCI_Pool *pool
 );
 
 /**
  * @brief
- * Cancel current pending changes
+ * Get the connection bound to the calling thread
  *
- * @param con - Connection handle
+ * @param pool - Pool handle
+ *
+ * @note
+ * The first call from a given thread retrieves a connection from the pool like
+ * OCI_PoolGetConnection() does and binds it to the thread.
+ * Subsequent calls from the same thread return the same connection without
+ * taking any lock.
+ *
+ * @note
+ * The connection is returned to the pool:
+ * - when the thread exits
+ * - when OCI_PoolReleaseThreadConnection() is called from the thread
+ * - when the pool is freed with OCI_PoolFree() or OCI_Cleanup()
+ *
+ * @warning
+ * The returned connection must not be freed with OCI_ConnectionFree().
+ * Connections bound to threads are only returned on thread exit for threads
+ * whose exit is managed by the system threads library (it is not the case
+ * of the main thread of the process).
  *
  * @return
- * TRUE on success otherwise FALSE
+ * Connection handle otherwise NULL on failure
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_Rollback
+OCI_EXPORT OCI_Connection * OCI_API OCI_PoolGetThreadConnection
 (
-    OCI_Connection *con
+    OCI_Pool *pool
 );
 
 /**
  * @brief
- * Enable / disable auto commit mode
+ * Return the connection bound to the calling thread to the pool
  *
- * The auto commit mode allows commit changes after every executed SQL order
+ * @param pool - Pool handle
  *
- * @param con    - Connection handle
- * @param enable - Enable (TRUE) or disable (FALSE)
+ * @note
+ * Does nothing if no connection is bound to the calling thread.
+ * The next call to OCI_PoolGetThreadConnection() from the thread binds a new connection
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_SetAutoCommit
+OCI_EXPORT boolean OCI_API OCI_PoolReleaseThreadConnection
 (
-    OCI_Connection *con,
-    boolean         enable
+    OCI_Pool *pool
 );
 
 /**
  * @brief
- * Get current auto commit mode status
+ * Create a pool router
  *
- * @param con - Connection handle
+ * @note
+ * A pool router owns several pools, for example targeting different services of an
+ * active/active configuration, and retrieves connections from the most appropriate one.
  *
  * @return
- * TRUE if auto commit mode is activated otherwise FALSE
+ * Return the pool router handle on success otherwise NULL on failure
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_GetAutoCommit
+OCI_EXPORT OCI_PoolRouter * OCI_API OCI_PoolRouterCreate
 (
-    OCI_Connection *con
+    void
 );
 
 /**
  * @brief
- * Create a new global transaction or a serializable/read-only local transaction
- *
- * @param con     - Connection handle
- * @param timeout - Time that a transaction stays inactive after being stopped
- * @param mode    - Transaction mode
- * @param pxid    - pointer to a global transaction identifier structure
+ * Destroy a pool router object and all the pools it owns
  *
+ * @param router - Pool router handle
  *
- * @note
- * The parameter 'mode' can be one of the following values :
+ * @return
+ * TRUE on success otherwise FALSE
  *
- * - Global transactions:
+ */
+
+OCI_EXPORT boolean OCI_API OCI_PoolRouterFree
+(
+    OCI_PoolRouter *router
+);
+
+/**
+ * @brief
+ * Add a pool to the given pool router
+ *
+ * @param router - Pool router handle
+ * @param pool   - Pool handle
+ * @param weight - Pool relative weight (at least 1)
+ *
+ * @note
+ * The router takes the ownership of the pool that is freed by OCI_PoolRouterFree().
+ * Thus the pool cannot be freed with OCI_PoolFree() nor added to another router.
+ * Routers still opened when calling OCI_Cleanup() are freed with their pools.
+ *
+ * @note
+ * For the same load and latency, a pool with a weight of 2 is chosen over a pool with
+ * a weight of 1 until it serves twice as many busy sessions.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_PoolRouterAddPool
+(
+    OCI_PoolRouter *router,
+    OCI_Pool *      pool,
+    unsigned int    weight
+);
+
+/**
+ * @brief
+ * Return the number of pools owned by the given pool router
+ *
+ * @param router - Pool router handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_PoolRouterGetCount
+(
+    OCI_PoolRouter *router
+);
+
+/**
+ * @brief
+ * Return a pool owned by the given pool router
+ *
+ * @param router - Pool router handle
+ * @param index  - Pool index (starting at 1)
+ *
+ * @return
+ * Pool handle on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_Pool * OCI_API OCI_PoolRouterGetPool
+(
+    OCI_PoolRouter *router,
+    unsigned int    index
+);
+
+/**
+ * @brief
+ * Get a connection from the most appropriate pool of the given pool router
+ *
+ * @param router - Pool router handle
+ * @param tag    - user tag string
+ *
+ * @note
+ * Each pool is given a cost computed as its number of busy sessions (plus one, and plus one
+ * again if no idle session is available) multiplied by its average observed checkout latency
+ * and divided by its weight. Saturated pools come after other pools and pools that failed
+ * during the back off period (see OCI_PoolRouterSetBackOff()) come last.
+ *
+ * @note
+ * If retrieving a connection from the chosen pool fails, the next best pool is tried until
+ * all pools have been tried.
+ * The error handler, if any, is called for each failed attempt.
+ *
+ * @note
+ * The returned connection is a regular pooled connection, see OCI_PoolGetConnection()
+ * for details about the tag parameter and how to release the connection.
+ *
+ * @return
+ * Connection handle otherwise NULL on failure
+ *
+ */
+
+OCI_EXPORT OCI_Connection * OCI_API OCI_PoolRouterGetConnection
+(
+    OCI_PoolRouter *router,
+    const otext *   tag
+);
+
+/**
+ * @brief
+ * Return the delay in seconds during which a pool that failed is used only as a last resort
+ *
+ * @param router - Pool router handle
+ *
+ * @note
+ * Default value is 30 seconds
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_PoolRouterGetBackOff
+(
+    OCI_PoolRouter *router
+);
+
+/**
+ * @brief
+ * Set the delay in seconds during which a pool that failed is used only as a last resort
+ *
+ * @param router - Pool router handle
+ * @param value  - Delay in seconds
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_PoolRouterSetBackOff
+(
+    OCI_PoolRouter *router,
+    unsigned int    value
+);
+
+/**
+ * @} OcilibCApiPools
+ */
+
+/**
+ * @defgroup OcilibCApiTransactions Managing transactions
+ * @{
+ *
+ * OCILIB supports local and global transactions.
+ *
+ * Local transactions are implicit within connection objects and there is no
+ * specific call or programming step for using it.
+ *
+ * In order to control changes made in the database:
+ *
+ * - OCI_Commit() validates current pending modifications
+ * - OCI_Rollback() discards current pending modifications
+ *
+ * OCILIB supports a feature called 'Auto Commit' that performs an implicit and
+ * automatic commit call after every execute call
+ *
+ * @note
+ * Those actions are executed within a connection context and not directly to a transaction.
+ *
+ * @warning
+ * Global transactions are optional and are designed for distributed or global
+ * transaction environments.
+ *
+ * OCILIB supports them by :
+ *
+ * - Creating/Destroying explicitly a transaction object
+ * - Starting/Stopping/Resuming explicitly the transaction
+ * - Preparing the transaction for specific calls
+ *
+ */
+
+/**
+ * @brief
+ * Commit current pending changes
+ *
+ * @param con - Connection handle
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_Commit
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Cancel current pending changes
+ *
+ * @param con - Connection handle
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_Rollback
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Enable / disable auto commit mode
+ *
+ * The auto commit mode allows commit changes after every executed SQL order
+ *
+ * @param con    - Connection handle
+ * @param enable - Enable (TRUE) or disable (FALSE)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetAutoCommit
+(
+    OCI_Connection *con,
+    boolean         enable
+);
+
+/**
+ * @brief
+ * Get current auto commit mode status
+ *
+ * @param con - Connection handle
+ *
+ * @return
+ * TRUE if auto commit mode is activated otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetAutoCommit
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Create a new global transaction or a serializable/read-only local transaction
+ *
+ * @param con     - Connection handle
+ * @param timeout - Time that a transaction stays inactive after being stopped
+ * @param mode    - Transaction mode
+ * @param pxid    - pointer to a global transaction identifier structure
+ *
+ *
+ * @note
+ * The parameter 'mode' can be one of the following values :
+ *
+ * - Global transactions:
  *      - OCI_TRS_NEW : By default starts a new, tightly coupled and
  *                      migratable branch.
  *      - OCI_TRS_TIGHT : explicitly specifies a tightly coupled branch
@@ -2069,6 +2644,69 @@ OCI_EXPORT boolean OCI_API OCI_StatementFree
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Return a prepared statement for the given SQL from the connection prepared statements cache
+ *
+ * @param con - Connection handle
+ * @param sql - SQL order or PL/SQL block
+ * @param key - Optional bind signature (can be NULL)
+ *
+ * @note
+ * If a statement previously released with OCI_StatementRelease() matches both the SQL text and
+ * the key, it is returned as is, with its binds and its resultset defines. Otherwise, a new
+ * statement is created and prepared.
+ *
+ * @note
+ * The key allows to keep several statements for the same SQL with different binds (data types,
+ * array sizes, ...). Statements acquired with a NULL key only match statements released with a
+ * NULL key.
+ *
+ * @note
+ * Acquired statements keep their rebinding setting (see OCI_AllowRebinding()). Binds registered
+ * with OCI_BAM_EXTERNAL mode keep pointing to the program variables used when they were first
+ * bound.
+ *
+ * @warning
+ * Statements acquired with this function must be given back with OCI_StatementRelease() and
+ * must not be freed with OCI_StatementFree() once released.
+ *
+ * @return
+ * A prepared statement handle on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_Statement * OCI_API OCI_StatementAcquire
+(
+    OCI_Connection *con,
+    const otext *   sql,
+    const otext *   key
+);
+
+/**
+ * @brief
+ * Give back a statement acquired with OCI_StatementAcquire() to the prepared statements cache
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * If the cache is full, its least recently used statement is freed.
+ * If the cache is disabled (see OCI_SetPreparedCacheSize()) or if the statement is not
+ * prepared, the statement is freed.
+ *
+ * @note
+ * Releasing or freeing a statement kept by the cache fails with an OCI_ERR_STMT_RELEASED error.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_StatementRelease
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Prepare a SQL statement or PL/SQL block.
@@ -2113,6 +2751,80 @@ OCI_EXPORT boolean OCI_API OCI_Execute
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Start the execution of a prepared SQL statement or PL/SQL block without blocking
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * The connection server handle is switched to non blocking mode and the
+ * execution is started. If the server has not completed the call yet, the
+ * function returns immediately and the execution must be driven to completion
+ * by calling OCI_ExecutePoll() until it does not return OCI_ASYNC_EXECUTING
+ * anymore, or by calling OCI_ExecuteWait().
+ * Once completed, the connection is switched back to blocking mode and the
+ * statement can be used as if executed with OCI_Execute().
+ *
+ * @warning
+ * While a call is pending, no other call can be performed on the same connection.
+ * A pending call can be aborted using OCI_Break().
+ *
+ * @return
+ * TRUE if the execution has been started or has already completed successfully otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Continue a non blocking execution started with OCI_ExecuteAsync()
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Possible values are :
+ * - OCI_ASYNC_EXECUTING : the call is still executing on the server
+ * - OCI_ASYNC_SUCCESS   : the call has completed successfully
+ * - OCI_ASYNC_FAILURE   : the call has failed (the error is reported as for OCI_Execute())
+ *
+ * @note
+ * If no call is pending, the status of the last non blocking execution is returned
+ *
+ * @return
+ * Non blocking execution status
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_ExecutePoll
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Wait for the completion of a non blocking execution started with OCI_ExecuteAsync()
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * The pending call is polled until completion, sleeping between polls with a delay
+ * doubling from 1 up to 100 milliseconds.
+ *
+ * @return
+ * TRUE if the execution has completed successfully otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_ExecuteWait
+(
+    OCI_Statement *stmt
+);
+
 /**
  * @brief
  * Prepare and Execute a SQL statement or PL/SQL block.
@@ -2994,6 +3706,52 @@ OCI_EXPORT boolean OCI_API OCI_BindArrayOfStrings
     unsigned int   nbelem
 );
 
+/**
+ * @brief
+ * Bind an array of strings packed in a single contiguous buffer
+ *
+ * @param stmt    - Statement handle
+ * @param name    - Variable name
+ * @param data    - Buffer holding all string elements one after the other
+ * @param offsets - Array of elements offsets (in bytes) within the buffer
+ * @param nbelem  - Number of element in the array (PL/SQL table only)
+ *
+ * @note
+ * Unlike OCI_BindArrayOfStrings(), elements are neither padded to a fixed
+ * width nor null terminated. Element i starts at offsets[i] and its length
+ * is offsets[i + 1] - offsets[i], thus 'offsets' must hold one more entry
+ * than the number of elements (bind array size or 'nbelem').
+ * This is the layout used by column oriented formats (e.g. Apache Arrow
+ * variable size binary/string columns), allowing to bind such columns
+ * without any copy.
+ *
+ * @note
+ * Strings are passed as is to Oracle and thus must be encoded in the client
+ * character set used by OCILIB (NLS_LANG charset for ANSI builds, UTF-16 for
+ * Unicode builds). Empty elements are handled as NULL values by Oracle.
+ *
+ * @warning
+ * Parameter 'nbelem' SHOULD ONLY be USED for PL/SQL tables.
+ * For regular DML array operations, pass the value 0.
+ *
+ * @warning
+ * This bind is input only and cannot be used with the OCI_BAM_INTERNAL
+ * allocation mode. Buffer and offsets must remain valid until the statement
+ * is executed.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindArrayOfPackedStrings
+(
+    OCI_Statement *stmt,
+    const otext *  name,
+    void *         data,
+    unsigned int * offsets,
+    unsigned int   nbelem
+);
+
 /**
  * @brief
  * Bind a raw buffer
@@ -4493,6 +5251,33 @@ OCI_EXPORT boolean OCI_API OCI_FetchNext
     OCI_Resultset *rs
 );
 
+/**
+ * @brief
+ * Fetch the next row of the resultset without blocking
+ *
+ * @param rs - Resultset handle
+ *
+ * @note
+ * When rows are still available from the last server round trip, this call
+ * behaves like OCI_FetchNext(). Otherwise, the next round trip is performed
+ * in non blocking mode and the function must be called again, as long as it
+ * returns OCI_ASYNC_EXECUTING, before using the resultset.
+ *
+ * @note
+ * Piecewise fetches of LONG columns are not supported in non blocking mode.
+ *
+ * @return
+ * - OCI_ASYNC_EXECUTING : the round trip is still executing on the server
+ * - OCI_ASYNC_SUCCESS   : the next row is available
+ * - OCI_ASYNC_FAILURE   : no more rows or an error occurred
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_FetchNextAsync
+(
+    OCI_Resultset *rs
+);
+
 /**
  * @brief
  * Fetch the previous row of the resultset
@@ -8749,6 +9534,99 @@ OCI_EXPORT boolean OCI_API OCI_LobWrite2
     unsigned int *byte_count
 );
 
+/**
+ * @brief
+ * Write a buffer into each lob of the given array in a single server round trip
+ *
+ * @param lobs    - Array of lob handles
+ * @param count   - Number of lobs in the array
+ * @param buffers - Array of pointers to buffers
+ * @param sizes   - [in/out] Array of buffer lengths (in bytes or characters)
+ *
+ * @note
+ * Lengths are expressed in :
+ * - Bytes for BLOBs
+ * - Characters for CLOBs/NCLOBs
+ *
+ * @note
+ * In input,  'sizes' are the amounts to write from each buffer
+ * In output, 'sizes' are the amounts written into each lob
+ *
+ * @note
+ * Buffers do not need to be null terminated. Entries with a zero size are not written
+ * and their buffer can be NULL, as OCI_LobWrite() returns 0 for empty buffers.
+ *
+ * @note
+ * Each buffer is written at the current offset of its lob that is then moved
+ * past the written data, as with OCI_LobWrite()
+ *
+ * @note
+ * All lobs must be of the same type and belong to the same connection.
+ * Typical usage is filling the lobs of an array created with OCI_LobArrayCreate()
+ * before binding it to an array DML statement
+ *
+ * @warning
+ * This call requires Oracle 11g R1 or above for both client and server
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobArrayWrite
+(
+    OCI_Lob **     lobs,
+    unsigned int   count,
+    void **        buffers,
+    unsigned int * sizes
+);
+
+/**
+ * @brief
+ * Download a BLOB into a file using several sessions concurrently
+ *
+ * @param pool       - Pool handle providing the sessions
+ * @param sql        - Query returning the BLOB in the first column of its first row
+ * @param filename   - Destination file name
+ * @param nb_workers - Maximum number of sessions reading the lob concurrently
+ * @param handler    - Progress callback (optional)
+ * @param ctx        - Pointer passed to the progress callback
+ *
+ * @note
+ * The lob is split into ranges aligned on its chunk size. Each worker acquires a
+ * session from the pool, executes the query to get its own locator and then reads
+ * ranges, writing them at their offset in the destination file that is created
+ * or truncated.
+ *
+ * @note
+ * The number of workers is bounded by the pool maximum size and the number of ranges.
+ * Several workers require OCILIB to be initialized in multithreaded mode,
+ * otherwise the lob is downloaded by the calling thread.
+ *
+ * @note
+ * The progress callback is called from worker threads, one call at a time and
+ * outside of any internal lock, after buffers have been written to the file.
+ * Progress made by other workers during a call is reported by the next call.
+ *
+ * @warning
+ * The query must return the same lob in each session, e.g. by selecting it by primary key.
+ * Only BLOBs are supported as character lobs offsets do not match file offsets.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobDownload
+(
+    OCI_Pool *        pool,
+    const otext *     sql,
+    const otext *     filename,
+    unsigned int      nb_workers,
+    POCI_LOB_PROGRESS handler,
+    void *            ctx
+);
+
 /**
  * @brief
  * Truncate the given lob to a shorter length
@@ -13250,11 +14128,73 @@ OCI_EXPORT OCI_TypeInfo * OCI_API OCI_TypeInfoGetSuperType
  * - '%o'  : (OCI_Object *) -----> Object  (not implemented yet)
  * - '%c'  : (OCI_Coll *) -------> collection  (not implemented yet)
  *
+ * @par Format arguments mode
+ *
+ * By default, input values are formatted as literals within the SQL text. Thus every distinct
+ * value produces a distinct SQL text that has to be hard parsed by the server.
+ *
+ * Calling OCI_SetFormatArgsMode() with OCI_FAM_BIND changes this behavior for the given connection:
+ * - the format string is parsed once and the result is kept in a cache for later calls.
+ *   The cache holds up to 1024 format strings, further ones being parsed at each call
+ * - '%s', '%t', '%n', '%i', '%u', '%li', '%lu', '%hi', '%hu' and '%g' identifiers are replaced by
+ *   generated bind variables named ':1', ':2', ... in their order of appearance
+ * - values are copied into internally allocated binds (NULL strings, dates and numbers are bound as NULL)
+ *
+ * The SQL text sent to the server does not depend anymore on the values, allowing soft parses and
+ * statement cache hits.
+ * Format strings containing '%m', '%p', '%v' or '%r' identifiers are still formatted as literals.
+ *
  * @par Example
  * @include format.c
  *
  */
 
+/**
+ * @brief
+ * Set the way formatted functions handle their input values for the given connection
+ *
+ * @param con  - Connection handle
+ * @param mode - Format arguments mode
+ *
+ * @note
+ * Possible values are :
+ *  - OCI_FAM_LITERAL : input values are formatted as literals within the SQL text
+ *  - OCI_FAM_BIND    : input values are turned into bind variables (see formatted functions introduction)
+ *
+ * @note
+ * Default value is OCI_FAM_LITERAL
+ *
+ * @warning
+ * With OCI_FAM_BIND, bind variables named ':1', ':2', ... are generated by OCI_PrepareFmt().
+ * Additional program variables bound after calling OCI_PrepareFmt() must use different names.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFormatArgsMode
+(
+    OCI_Connection *con,
+    unsigned int    mode
+);
+
+/**
+ * @brief
+ * Return the way formatted functions handle their input values for the given connection
+ *
+ * @param con  - Connection handle
+ *
+ * @note
+ * See OCI_SetFormatArgsMode() for possible values
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetFormatArgsMode
+(
+    OCI_Connection *con
+);
+
 /**
  * @brief
  * Perform 3 calls (prepare+execute+fetch) in 1 call
@@ -14015,7 +14955,7 @@ OCI_EXPORT void * OCI_API OCI_ThreadKeyGetValue
  * @param typinf    - Table type info handle
  * @param partition - Partition name
  * @param nb_cols   - Number of columns to load
- * @param nb_rows   - Maximum of rows to handle per load operation
+ * @param nb_rows   - Maximum of rows to handle per load operation (0 for automatic sizing)
  *
  * @note
  * Retrieve the table type info handle with OCI_TypeInfoGet().
@@ -14029,6 +14969,13 @@ OCI_EXPORT void * OCI_API OCI_ThreadKeyGetValue
  * been successfully called, OCI_DirPathGetMaxRows() returns the final number
  * of rows used for the given direct path operation.
  *
+ * @note
+ * If 'nb_rows' is 0, the number of rows is computed by OCI_DirPathPrepare() in order
+ * to fill the stream transfer buffer with rows of the maximum size of the columns.
+ * The buffer size is the one set with OCI_DirPathSetBufferSize() or 1MB by default.
+ * Thus, tables with wide rows are loaded with fewer rows per stream and narrow
+ * rows tables with more rows per stream, each load round trip carrying a full buffer.
+ *
  * @return
  * Return the direct path handle on success otherwise NULL on failure
  *
@@ -14072,6 +15019,7 @@ OCI_EXPORT boolean OCI_API OCI_DirPathFree
  * - If the column specified by the 'name' parameter is not found in the table
  *   referenced by the type info handle passed to OCI_DirPathCreate()
  * - the index is out of bounds (= 0 or >= number of columns)
+ * - maxsize is too large for the column buffers size to fit in 32 bits
  *
  * @return
  * TRUE on success otherwise FALSE
@@ -14134,23 +15082,121 @@ OCI_EXPORT boolean OCI_API OCI_DirPathPrepare
  *   TRUE for the 'complete' parameter
  *
  * @warning
- * Current Direct Path OCILIB implementation DOES NOT support setting entry
- * content piece by piece as mentioned above. It was planned in the original design
- * but not supported yet. So, always set the complete parameter to TRUE.
- * Setting entries content piece by piece may be supported in future releases
+ * Current Direct Path OCILIB implementation DOES NOT support setting entry
+ * content piece by piece as mentioned above. It was planned in the original design
+ * but not supported yet. So, always set the complete parameter to TRUE.
+ * Setting entries content piece by piece may be supported in future releases
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetEntry
+(
+    OCI_DirPath *dp,
+    unsigned int row,
+    unsigned int index,
+    void *       value,
+    unsigned     size,
+    boolean      complete
+);
+
+/**
+ * @brief
+ * Set the values of a range of rows for the given column array
+ *
+ * @param dp        - Direct path Handle
+ * @param row       - Index of the first row to set
+ * @param index     - Column index
+ * @param count     - Number of rows to set
+ * @param values    - Buffer holding 'count' contiguous values
+ * @param stride    - Size in bytes of each value cell within 'values'
+ * @param sizes     - Array of 'count' value sizes (optional)
+ * @param nulls     - Array of 'count' null indicators (optional)
+ *
+ * @note
+ * This call is equivalent to calling OCI_DirPathSetEntry() for rows [row, row + count)
+ * of the given column but performs all checks once for the whole range.
+ * It is meant for loads with many columns where per entry call overhead matters.
+ *
+ * @note
+ * Rows and columns indexes start at 1.
+ *
+ * @note
+ * The value of the row 'row + i' is located at offset 'i * stride' in the 'values'
+ * buffer. Values sizes are expressed in the same unit than OCI_DirPathSetEntry().
+ * When the 'sizes' parameter is NULL :
+ * - binary columns values are 'stride' bytes long
+ * - other columns values are null terminated strings
+ *
+ * @note
+ * When the 'nulls' parameter is not NULL, rows having a TRUE indicator are set to NULL
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetEntries
+(
+    OCI_DirPath * dp,
+    unsigned int  row,
+    unsigned int  index,
+    unsigned int  count,
+    void *        values,
+    unsigned int  stride,
+    unsigned int *sizes,
+    boolean *     nulls
+);
+
+/**
+ * @brief
+ * Set the value of the given row/column array entry by reference
+ *
+ * @param dp        - Direct path Handle
+ * @param row       - Row index
+ * @param index     - Column index
+ * @param value     - Pointer to the value to set
+ * @param size      - Size in bytes of the input value
+ * @param complete  - Is the entry content fully provided ?
+ *
+ * @note
+ * Unlike OCI_DirPathSetEntry(), the input value is not copied into the direct path
+ * internal buffers. The given pointer and size are passed as is to OCI when the
+ * rows are converted. It avoids copying data that is already held by the program
+ * in a stable buffer (e.g. memory mapped file, parsed records batch...)
+ *
+ * @note
+ * Rows and columns indexes start at 1.
+ *
+ * @note
+ * As no conversion is performed, the input buffer must be provided in the format
+ * expected by the column :
+ * - raw bytes for binary columns
+ * - strings in the client character set for other columns (UTF16 for Unicode builds)
+ *
+ * @warning
+ * The buffer pointed by 'value' must remain valid until the row has been converted,
+ * meaning until OCI_DirPathConvert() returns a value other than OCI_DPR_FULL or the
+ * direct path array is reset.
+ *
+ * @warning
+ * Numeric columns described with a numeric format in OCI_DirPathSetColumn() are
+ * not supported as their values need an internal conversion
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DirPathSetEntry
+OCI_EXPORT boolean OCI_API OCI_DirPathSetEntryByRef
 (
     OCI_DirPath *dp,
     unsigned int row,
     unsigned int index,
-    void *       value,
-    unsigned     size,
+    const void * value,
+    unsigned int size,
     boolean      complete
 );
 
@@ -14237,6 +15283,67 @@ OCI_EXPORT boolean OCI_API OCI_DirPathReset
     OCI_DirPath *dp
 );
 
+/**
+ * @brief
+ * Load the content of a delimited text file (e.g. CSV file)
+ *
+ * @param dp         - Direct path Handle
+ * @param filename   - Path of the file to load
+ * @param delimiter  - Fields delimiter
+ * @param quote      - Fields quote character (0 if fields are not quoted)
+ * @param skip_lines - Number of non empty lines to skip at the beginning of the file (headers)
+ *
+ * @note
+ * The file is memory mapped and each line is a row whose fields are set to the
+ * direct path columns in their order of declaration with OCI_DirPathSetColumn().
+ * Rows are converted and loaded each time the direct path arrays are full, as
+ * OCI_DirPathConvert() and OCI_DirPathLoad() would do.
+ *
+ * @note
+ * Parsing rules:
+ * - Lines end with LF, CRLF or CR and empty lines are ignored
+ * - Fields starting with the quote character end at the next quote character,
+ *   and may contain delimiters and line breaks. A doubled quote stands for a single one
+ * - Empty fields and missing trailing fields are loaded as NULL
+ * - Fields beyond the number of columns are ignored
+ *
+ * @note
+ * Whenever possible, field values are not copied and are passed to OCI by reference
+ * from the file mapping. Values of numeric columns described with a numeric format,
+ * fields containing doubled quotes and, for Unicode builds, values of character
+ * columns are copied into the direct path internal buffers.
+ *
+ * @note
+ * Date and numeric formats set with OCI_DirPathSetDateFormat() and OCI_DirPathSetColumn()
+ * are applied as usual. The file content must be in the client character set.
+ * For Unicode builds, each byte of the file is handled as a single character.
+ *
+ * @note
+ * In OCI_DCM_FORCE conversion mode, rows that cannot be converted are discarded.
+ * OCI_DirPathGetRowCount() returns the number of rows loaded so far.
+ *
+ * @note
+ * Fields longer than the column maximum size are not truncated. In OCI_DCM_FORCE
+ * conversion mode, their row is discarded. Otherwise, the load fails with an
+ * OCI_ERR_ARG_INVALID_VALUE error reporting the number of the line (empty lines excluded).
+ *
+ * @warning
+ * The delimiter and the quote character must be single byte characters.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoadFile
+(
+    OCI_DirPath  *dp,
+    const otext  *filename,
+    otext         delimiter,
+    otext         quote,
+    unsigned int  skip_lines
+);
+
 /**
  * @brief
  * Terminate a direct path operation and commit changes into the database
@@ -14437,6 +15544,44 @@ OCI_EXPORT boolean OCI_API OCI_DirPathSetParallel
     boolean      value
 );
 
+/**
+ * @brief
+ * Set the pipelined loading mode
+ *
+ * @param dp    - Direct path Handle
+ * @param value - enable/disable pipelined mode
+ *
+ * @note
+ * Default value is FALSE.
+ *
+ * @note
+ * When enabled, two direct path streams are used. OCI_DirPathLoad() hands the
+ * converted stream over to a worker thread that loads it to the server and returns
+ * immediately, so the next rows can be set and converted into the second stream
+ * while the previous ones are loaded.
+ *
+ * @note
+ * In pipelined mode, OCI_DirPathLoad() first waits for the stream submitted at its
+ * previous call. Thus, its return value, OCI_DirPathGetAffectedRows(),
+ * OCI_DirPathGetErrorRow() and OCI_DirPathGetErrorColumn() refer to the previously
+ * submitted stream. The load of the last stream is completed by OCI_DirPathFinish()
+ * or OCI_DirPathSave().
+ *
+ * @warning
+ * This mode requires OCILIB to be initialized in multi threaded mode and must be
+ * set before calling OCI_DirPathPrepare()
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetPipelined
+(
+    OCI_DirPath *dp,
+    boolean      value
+);
+
 /**
  * @brief
  * Set the logging mode for the loading operation
@@ -14495,7 +15640,11 @@ OCI_EXPORT boolean OCI_API OCI_DirPathSetCacheSize
  * @param size - Buffer size
  *
  * @note
- * Default value is 64KB.
+ * Default value is 64KB, or 1MB when the direct path handle has been created
+ * with automatic sizing (see OCI_DirPathCreate()).
+ *
+ * @note
+ * With automatic sizing, the number of rows per stream is derived from this size.
  *
  * @return
  * TRUE on success otherwise FALSE
@@ -14649,6 +15798,301 @@ OCI_EXPORT unsigned int OCI_API OCI_DirPathGetErrorRow
     OCI_DirPath *dp
 );
 
+/**
+ * @brief
+ * Create a direct path loader spreading the load of a table over several sessions
+ *
+ * @param typinf     - Table type info handle
+ * @param partition  - Partition name
+ * @param nb_cols    - Number of columns to load
+ * @param nb_rows    - Maximum of rows to handle per batch
+ * @param nb_workers - Number of sessions loading the table (at most 32)
+ *
+ * @note
+ * OCILIB must be initialized with OCI_ENV_THREADED.
+ *
+ * @note
+ * The loader establishes 'nb_workers' new sessions with the credentials of the connection
+ * 'typinf' belongs to. Each session owns a direct path handle created with the given
+ * partition, columns and rows count, with parallel mode enabled (see OCI_DirPathSetParallel()).
+ *
+ * @note
+ * Rows are provided by batches. OCI_DirPathLoaderGetBatch() returns the direct path handle of
+ * the next session to fill using OCI_DirPathSetEntry(), OCI_DirPathSetEntries() or
+ * OCI_DirPathSetCurrentRows(). OCI_DirPathLoaderSubmit() then hands the batch over to a thread
+ * that converts and loads it while the caller fills the next batches for other sessions.
+ * Thus, client side conversions are performed concurrently.
+ *
+ * @warning
+ * Parallel direct path loads do not maintain indexes. See Oracle documentation
+ * for parallel direct path loads restrictions.
+ *
+ * @return
+ * Return the direct path loader handle on success otherwise NULL on failure
+ *
+ */
+
+OCI_EXPORT OCI_DirPathLoader * OCI_API OCI_DirPathLoaderCreate
+(
+    OCI_TypeInfo *typinf,
+    const otext * partition,
+    unsigned int  nb_cols,
+    unsigned int  nb_rows,
+    unsigned int  nb_workers
+);
+
+/**
+ * @brief
+ * Free a direct path loader, its direct path handles and its sessions
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @note
+ * Batches being processed are waited for. Loads that have not been finished are discarded.
+ *
+ * @note
+ * Loaders still opened when calling OCI_Cleanup() are freed the same way.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderFree
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Describe a column to load for all the sessions of the given direct path loader
+ *
+ * @param dpl     - Direct path loader handle
+ * @param index   - Column index
+ * @param name    - Column name
+ * @param maxsize - Maximum input value size for a column entry
+ * @param format  - Date or numeric format to use
+ *
+ * @note
+ * See OCI_DirPathSetColumn() for details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderSetColumn
+(
+    OCI_DirPathLoader *dpl,
+    unsigned int       index,
+    const otext *      name,
+    unsigned int       maxsize,
+    const otext *      format
+);
+
+/**
+ * @brief
+ * Set the conversion mode of all the sessions of the given direct path loader
+ *
+ * @param dpl  - Direct path loader handle
+ * @param mode - Conversion mode
+ *
+ * @note
+ * See OCI_DirPathSetConvertMode() for details.
+ * With OCI_DCM_FORCE, rows that cannot be converted are skipped and accounted by
+ * OCI_DirPathLoaderGetRejectedCount(). With OCI_DCM_DEFAULT, a conversion error
+ * stops the processing of the batch.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderSetConvertMode
+(
+    OCI_DirPathLoader *dpl,
+    unsigned int       mode
+);
+
+/**
+ * @brief
+ * Prepare the direct path handles of all the sessions of the given direct path loader
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderPrepare
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Return the direct path handle of the next session to fill with rows
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @note
+ * Sessions hand out batches in turn. If the batch previously submitted to the session
+ * is still being processed, this call waits for its completion.
+ *
+ * @note
+ * The returned direct path handle is reset and must be filled with rows and then passed
+ * to OCI_DirPathLoaderSubmit(). It is owned by the loader and must not be converted,
+ * loaded, finished or freed by the application.
+ *
+ * @return
+ * The direct path handle to fill on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_DirPath * OCI_API OCI_DirPathLoaderGetBatch
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Submit a batch of rows to be converted and loaded in background
+ *
+ * @param dpl - Direct path loader handle
+ * @param dp  - Direct path handle returned by OCI_DirPathLoaderGetBatch()
+ *
+ * @note
+ * The batch is converted and loaded by a thread, the stream being loaded each time it
+ * is full. Errors raised while processing a batch are not reported to the caller thread.
+ * They are accounted by OCI_DirPathLoaderGetErrorCount() and OCI_DirPathLoaderGetErrorCode().
+ * The error handler, if any, is called from the thread processing the batch.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderSubmit
+(
+    OCI_DirPathLoader *dpl,
+    OCI_DirPath *      dp
+);
+
+/**
+ * @brief
+ * Wait for all submitted batches and terminate the loads of all sessions
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @note
+ * Rows of batches that have been returned by OCI_DirPathLoaderGetBatch() but not
+ * submitted are discarded.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderFinish
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Wait for all submitted batches and abort the loads of all sessions
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderAbort
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Return the number of sessions of the given direct path loader
+ *
+ * @param dpl - Direct path loader handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetWorkerCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Return the number of rows successfully loaded by all sessions so far
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @note
+ * Only batches that have been waited for are accounted. Call it after
+ * OCI_DirPathLoaderFinish() to get the total number of loaded rows.
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetRowCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Return the number of rows rejected during conversions or loads by all sessions so far
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @note
+ * Only batches that have been waited for are accounted.
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetRejectedCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Return the number of batches during which an error has been raised
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @note
+ * Only batches that have been waited for are accounted.
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetErrorCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+/**
+ * @brief
+ * Return the code of the last error raised while processing a batch
+ *
+ * @param dpl - Direct path loader handle
+ *
+ * @return
+ * The Oracle or OCILIB error code, -1 if it is unknown or 0 if no error has been raised
+ *
+ */
+
+OCI_EXPORT int OCI_API OCI_DirPathLoaderGetErrorCode
+(
+    OCI_DirPathLoader *dpl
+);
+
 /**
  * @} OcilibCApiDirectPath
  */
@@ -470,8 +470,13 @@ typedef unsigned int big_uint;
 #define OCI_ERR_XA_CONN_FROM_STRING         29
 #define OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED   30
 #define OCI_ERR_UNFREED_BYTES               31
+#define OCI_ERR_ASYNC_CALL_PENDING          32
+#define OCI_ERR_FILE_ACCESS                 33
+#define OCI_ERR_WORKER_FAILED               34
+#define OCI_ERR_POOL_ROUTED                 35
+#define OCI_ERR_STMT_RELEASED               36
 
-#define OCI_ERR_COUNT                       32
+#define OCI_ERR_COUNT                       37
 
 /* Public OCILIB handles */
 
@@ -506,6 +511,8 @@ typedef unsigned int big_uint;
 #define OCI_IPC_ENQUEUE          38
 #define OCI_IPC_DEQUEUE          39
 #define OCI_IPC_AGENT            40
+#define OCI_IPC_POOL_ROUTER      41
+#define OCI_IPC_DIRPATH_LOADER   42
 
 /* allocated bytes types */
 
@@ -590,6 +597,7 @@ typedef unsigned int big_uint;
 #define OCI_ENV_THREADED                    1
 #define OCI_ENV_CONTEXT                     2
 #define OCI_ENV_EVENTS                      4
+#define OCI_ENV_LAZY_BINDING                8
 
 /* sessions modes */
 
@@ -679,6 +687,17 @@ typedef unsigned int big_uint;
 #define OCI_BAM_EXTERNAL                    1
 #define OCI_BAM_INTERNAL                    2
 
+/* format arguments mode */
+
+#define OCI_FAM_LITERAL                     1
+#define OCI_FAM_BIND                        2
+
+/* non blocking calls status */
+
+#define OCI_ASYNC_FAILURE                   0
+#define OCI_ASYNC_EXECUTING                 1
+#define OCI_ASYNC_SUCCESS                   2
+
 /* bind direction mode */
 
 #define OCI_BDM_IN                          1
@@ -788,6 +807,10 @@ typedef unsigned int big_uint;
 #define OCI_POOL_CONNECTION                 1
 #define OCI_POOL_SESSION                    2
 
+/* pool checkout latency histogram size */
+
+#define OCI_POOL_LATENCY_BUCKETS            12
+
 /* AQ message state */
 
 #define OCI_AMS_READY                       1
@@ -94,6 +94,19 @@
 
 typedef struct OCI_Pool OCI_Pool;
 
+/**
+ * @typedef OCI_PoolRouter
+ *
+ * @brief
+ * Pool router object
+ *
+ * A pool router owns several pools and retrieves connections from the most
+ * appropriate one
+ *
+ */
+
+typedef struct OCI_PoolRouter OCI_PoolRouter;
+
 /**
  * @typedef OCI_Connection
  *
@@ -407,6 +420,19 @@ typedef struct OCI_Thread OCI_Thread;
 
 typedef struct OCI_DirPath OCI_DirPath;
 
+/**
+ * @typedef OCI_DirPathLoader
+ *
+ * @brief
+ * Direct path loader object
+ *
+ * A direct path loader spreads a direct path load of a table over several
+ * sessions, each one converting and loading its rows in its own thread
+ *
+ */
+
+typedef struct OCI_DirPathLoader OCI_DirPathLoader;
+
 /**
  * @typedef OCI_Subscription
  *
@@ -621,6 +647,25 @@ typedef void (*POCI_HA_HANDLER)
     OCI_Timestamp * time
 );
 
+/**
+ * @var POCI_LOB_PROGRESS
+ *
+ * @brief
+ * Lob download progress callback prototype.
+ *
+ * @param ctx   - Pointer passed to OCI_LobDownload()
+ * @param done  - Number of bytes downloaded so far
+ * @param total - Lob size in bytes
+ *
+ */
+
+typedef void (*POCI_LOB_PROGRESS)
+(
+    void *   ctx,
+    big_uint done,
+    big_uint total
+);
+
 /* public structures */
 
 /**
@@ -639,6 +684,56 @@ typedef struct OCI_XID
     char data[128];
 } OCI_XID;
 
+/**
+ * @typedef OCI_PoolStatistics
+ *
+ * @brief
+ * Pool checkout statistics snapshot
+ *
+ * Latencies are expressed in microseconds.
+ * See OCI_PoolGetStatistics() for a description of each field
+ *
+ */
+
+typedef struct OCI_PoolStatistics
+{
+    big_uint checkouts;
+    big_uint failures;
+    big_uint timeouts;
+    big_uint waits;
+    big_uint sessions_created;
+    big_uint sessions_destroyed;
+    big_uint tag_hits;
+    big_uint tag_misses;
+    big_uint latency_total;
+    big_uint latency_max;
+    big_uint latency_histogram[OCI_POOL_LATENCY_BUCKETS];
+} OCI_PoolStatistics;
+
+/**
+ * @typedef OCI_InitStatistics
+ *
+ * @brief
+ * Library initialization timings snapshot
+ *
+ * Durations are expressed in microseconds.
+ * See OCI_GetInitStatistics() for a description of each field
+ *
+ */
+
+typedef struct OCI_InitStatistics
+{
+    big_uint     setup_time;
+    big_uint     library_time;
+    big_uint     symbols_time;
+    big_uint     environment_time;
+    big_uint     objects_time;
+    big_uint     total_time;
+    big_uint     lazy_time;
+    unsigned int symbols_count;
+    unsigned int lazy_count;
+} OCI_InitStatistics;
+
 /**
  * @typedef OCI_Variant
  *
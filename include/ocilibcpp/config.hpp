@@ -36,6 +36,7 @@ extern "C" {
 #define OCILIBPP_CPP_98 199711L
 #define OCILIBPP_CPP_11 201103L
 #define OCILIBPP_CPP_14 201402L
+#define OCILIBPP_CPP_20 202002L
 
 #if __cplusplus < OCILIBPP_CPP_11
 
@@ -62,6 +63,16 @@ extern "C" {
 #define OCILIBPP_HAS_ENABLEIF
 #define OCILIBPP_HAS_VARIADIC
 
+#include <future>
+#define OCILIBPP_HAS_FUTURE
+
+#if __cplusplus >= OCILIBPP_CPP_20 || (defined(_MSVC_LANG) && _MSVC_LANG >= OCILIBPP_CPP_20)
+
+#include <span>
+#define OCILIBPP_HAS_SPAN
+
+#endif
+
 #ifdef  OCILIBCPP_DEBUG_MEMORY
 
 #include <iostream>
@@ -89,6 +100,10 @@ extern "C" {
 #undef OCILIBPP_HAS_VARIADIC
 #endif
 
+#ifdef OCILIBPP_HAS_FUTURE
+#undef OCILIBPP_HAS_FUTURE
+#endif
+
 #ifdef OCILIBPP_DEBUG_MEMORY_ENABLED
 #undef OCILIBPP_DEBUG_MEMORY_ENABLED
 #endif
@@ -198,6 +213,7 @@ template<class, int>
 class Lob;
 class File;
 class Pool;
+class PoolRouter;
 template<class, int>
 class Long;
 class Column;
@@ -210,6 +226,7 @@ class Dequeue;
 class Queue;
 class QueueTable;
 class DirectPath;
+class DirectPathLoader;
 class Thread;
 class ThreadKey;
 class Mutex;
@@ -22,6 +22,7 @@
 
 #include <list>
 #include <map>
+#include <unordered_map>
 
 #include "ocilibcpp/config.hpp"
 
@@ -276,6 +277,39 @@ namespace ocilib
 
         };
 
+       /**
+        * @brief Internal usage.
+        * Hash map split in independently locked shards supporting concurrent access from multiple threads
+        */ 
+        template<class K, class V, std::size_t N = 16>
+        class ConcurrentHashMap
+        {
+        public:
+
+            ConcurrentHashMap();
+            virtual ~ConcurrentHashMap() noexcept;
+
+            void SetAccessMode(bool threaded);
+
+            void Remove(K key);
+            V Get(K key);
+            void Set(K key, V value);
+            void Clear();
+            size_t GetSize();
+
+        private:
+
+            struct Shard
+            {
+                Locker locker;
+                std::unordered_map<K, V> map;
+            };
+
+            Shard& GetShard(K key);
+
+            Shard _shards[N];
+        };
+
        /**
         * @brief Internal usage.
         * List supporting concurrent access from multiple threads
@@ -305,18 +339,66 @@ namespace ocilib
             std::list<T> _list;
         };
 
+        class Handle;
+
+       /**
+        * @brief Internal usage.
+        * Intrusive list of handles supporting concurrent access from multiple threads
+        *
+        * @note
+        * Links are stored in the Handle objects themselves, thus adding and removing
+        * a handle is done in constant time without any allocation
+        */ 
+        class HandleList : public Lockable
+        {
+        public:
+
+            HandleList();
+            virtual ~HandleList() noexcept;
+
+            void Add(Handle* handle);
+            void Remove(Handle* handle);
+            size_t GetSize();
+
+            template<class P>
+            bool FindIf(P predicate, Handle*& handle);
+
+            template<class A>
+            void ForEach(A action);
+
+            template<class A>
+            void Release(A action);
+
+        private:
+
+            void Unlink(Handle* handle);
+
+            Handle* _head;
+            Handle* _tail;
+            size_t _size;
+        };
+
        /**
         * @brief Internal usage.
         * Interface for handling ownership and relationship of a C API handle
         */ 
         class Handle
         {
+            friend class HandleList;
+
         public:
 
+            Handle() : _list(nullptr), _previous(nullptr), _next(nullptr) {}
             virtual ~Handle() noexcept {}
-            virtual ConcurrentList<Handle*>& GetChildren() = 0;
+            virtual HandleList& GetChildren() = 0;
             virtual void DetachFromHolders() = 0;
             virtual void DetachFromParent() = 0;
+
+        private:
+
+            HandleList* _list;
+            Handle* _previous;
+            Handle* _next;
         };
 
         /**
@@ -375,7 +457,7 @@ namespace ocilib
                 AnyPointer GetExtraInfos() const;
                 void  SetExtraInfos(AnyPointer extraInfo);
 
-                ConcurrentList<Handle*>& GetChildren() override;
+                HandleList& GetChildren() override;
                 void DetachFromHolders() override;
                 void DetachFromParent() override;
 
@@ -385,7 +467,7 @@ namespace ocilib
                 static void ResetHolder(HandleHolder* holder);
 
                 ConcurrentList<HandleHolder*> _holders;
-                ConcurrentList<Handle*>  _children;
+                HandleList _children;
 
                 Locker _locker;
 
@@ -51,6 +51,30 @@ inline void Connection::Open(const ostring& db, const ostring& user, const ostri
         reinterpret_cast<HandleFreeFunc>(OCI_ConnectionFree), nullptr, Environment::GetEnvironmentHandle());
 }
 
+inline std::vector<Connection> Connection::OpenMany(const ostring& db, const ostring& user, const ostring& pwd, unsigned int count,
+                                                    std::vector<int>& errors, Environment::SessionFlags sessionFlags)
+{
+    std::vector<OCI_Connection*> handles(count, nullptr);
+    std::vector<Connection> connections;
+
+    errors.assign(count, 0);
+
+    if (count > 0)
+    {
+        core::Check(OCI_ConnectionCreateMany(db.c_str(), user.c_str(), pwd.c_str(), sessionFlags.GetValues(),
+                                             &handles[0], &errors[0], count));
+    }
+
+    connections.reserve(count);
+
+    for (auto handle : handles)
+    {
+        connections.push_back(handle ? Connection(handle, Environment::GetEnvironmentHandle()) : Connection());
+    }
+
+    return connections;
+}
+
 inline void Connection::Close()
 {
     Release();
@@ -246,6 +270,46 @@ inline void Connection::SetStatementCacheSize(unsigned int value)
     core::Check(OCI_SetStatementCacheSize(*this, value));
 }
 
+inline unsigned int Connection::GetPreparedCacheSize() const
+{
+    return core::Check(OCI_GetPreparedCacheSize(*this));
+}
+
+inline void Connection::SetPreparedCacheSize(unsigned int value)
+{
+    core::Check(OCI_SetPreparedCacheSize(*this, value));
+}
+
+inline unsigned int Connection::GetPreparedCacheHits() const
+{
+    return core::Check(OCI_GetPreparedCacheHits(*this));
+}
+
+inline unsigned int Connection::GetPreparedCacheMisses() const
+{
+    return core::Check(OCI_GetPreparedCacheMisses(*this));
+}
+
+inline unsigned int Connection::GetTemporaryLobCacheSize() const
+{
+    return core::Check(OCI_GetTemporaryLobCacheSize(*this));
+}
+
+inline void Connection::SetTemporaryLobCacheSize(unsigned int value)
+{
+    core::Check(OCI_SetTemporaryLobCacheSize(*this, value));
+}
+
+inline unsigned int Connection::GetTemporaryLobCacheHits() const
+{
+    return core::Check(OCI_GetTemporaryLobCacheHits(*this));
+}
+
+inline unsigned int Connection::GetTemporaryLobCacheMisses() const
+{
+    return core::Check(OCI_GetTemporaryLobCacheMisses(*this));
+}
+
 inline unsigned int Connection::GetDefaultLobPrefetchSize() const
 {
     return core::Check(OCI_GetDefaultLobPrefetchSize(*this));
@@ -30,6 +30,11 @@ inline DirectPath::DirectPath(const TypeInfo &typeInfo, unsigned int nbCols, uns
     Acquire(core::Check(OCI_DirPathCreate(typeInfo, partition.c_str(), nbCols, nbRows)), reinterpret_cast<HandleFreeFunc>(OCI_DirPathFree), nullptr, nullptr);
 }
 
+inline DirectPath::DirectPath(OCI_DirPath* pDirPath, core::Handle* parent)
+{
+    Acquire(pDirPath, nullptr, nullptr, parent);
+}
+
 inline void DirectPath::SetColumn(unsigned int colIndex, const ostring& name, unsigned int maxSize,  const ostring& format)
 {
     core::Check(OCI_DirPathSetColumn(*this, colIndex, name.c_str(), maxSize, format.c_str()));
@@ -41,6 +46,60 @@ inline void DirectPath::SetEntry(unsigned int rowIndex, unsigned int colIndex, c
     core::Check(OCI_DirPathSetEntry(*this, rowIndex, colIndex, static_cast<const AnyPointer>(const_cast<typename T::value_type *>(value.c_str())), static_cast<unsigned int>(value.size()), complete));
 }
 
+template<class T>
+inline void DirectPath::SetEntries(unsigned int rowIndex, unsigned int colIndex, const std::vector<T>& values)
+{
+    SetEntries(rowIndex, colIndex, values, std::vector<bool>());
+}
+
+template<class T>
+inline void DirectPath::SetEntries(unsigned int rowIndex, unsigned int colIndex, const std::vector<T>& values, const std::vector<bool>& nulls)
+{
+    typedef typename T::value_type ValueType;
+
+    const size_t count = values.size();
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    /* pack values into fixed size cells, leaving room for strings null terminators */
+
+    size_t maxSize = 0;
+
+    for (const auto& value : values)
+    {
+        maxSize = value.size() > maxSize ? value.size() : maxSize;
+    }
+
+    const size_t stride = maxSize + 1;
+
+    std::vector<ValueType> buffer(count * stride);
+    std::vector<unsigned int> sizes(count);
+    std::vector<boolean> indicators(count, FALSE);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        std::copy(values[i].begin(), values[i].end(), buffer.begin() + i * stride);
+
+        sizes[i] = static_cast<unsigned int>(values[i].size());
+
+        if (i < nulls.size() && nulls[i])
+        {
+            indicators[i] = TRUE;
+        }
+    }
+
+    core::Check(OCI_DirPathSetEntries(*this, rowIndex, colIndex, static_cast<unsigned int>(count), buffer.data(),
+                                      static_cast<unsigned int>(stride * sizeof(ValueType)), sizes.data(), indicators.data()));
+}
+
+inline void DirectPath::SetEntryByRef(unsigned int rowIndex, unsigned int colIndex, const void* value, unsigned int size, bool complete)
+{
+    core::Check(OCI_DirPathSetEntryByRef(*this, rowIndex, colIndex, value, size, complete));
+}
+
 inline void DirectPath::Reset()
 {
     core::Check(OCI_DirPathReset(*this));
@@ -61,6 +120,11 @@ inline DirectPath::Result DirectPath::Load()
     return Result(static_cast<Result::Type>(core::Check(OCI_DirPathLoad(*this))));
 }
 
+inline void DirectPath::LoadFile(const ostring& filename, otext delimiter, otext quote, unsigned int skipLines)
+{
+    core::Check(OCI_DirPathLoadFile(*this, filename.c_str(), delimiter, quote, skipLines));
+}
+
 inline void DirectPath::Finish()
 {
     core::Check(OCI_DirPathFinish(*this));
@@ -116,6 +180,11 @@ inline void DirectPath::SetParallel(bool value)
     core::Check(OCI_DirPathSetParallel(*this, value));
 }
 
+inline void DirectPath::SetPipelined(bool value)
+{
+    core::Check(OCI_DirPathSetPipelined(*this, value));
+}
+
 inline void DirectPath::SetNoLog(bool value)
 {
     core::Check(OCI_DirPathSetNoLog(*this, value));
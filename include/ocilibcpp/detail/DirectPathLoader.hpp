@@ -0,0 +1,95 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/types.hpp"
+
+namespace ocilib
+{
+
+inline DirectPathLoader::DirectPathLoader(const TypeInfo& typeInfo, unsigned int nbCols, unsigned int nbRows,
+                                          unsigned int nbWorkers, const ostring& partition)
+{
+    Acquire(core::Check(OCI_DirPathLoaderCreate(typeInfo, partition.c_str(), nbCols, nbRows, nbWorkers)),
+            reinterpret_cast<HandleFreeFunc>(OCI_DirPathLoaderFree), nullptr, nullptr);
+}
+
+inline void DirectPathLoader::SetColumn(unsigned int colIndex, const ostring& name, unsigned int maxSize, const ostring& format)
+{
+    core::Check(OCI_DirPathLoaderSetColumn(*this, colIndex, name.c_str(), maxSize, format.c_str()));
+}
+
+inline void DirectPathLoader::SetConversionMode(DirectPath::ConversionMode value)
+{
+    core::Check(OCI_DirPathLoaderSetConvertMode(*this, value));
+}
+
+inline void DirectPathLoader::Prepare()
+{
+    core::Check(OCI_DirPathLoaderPrepare(*this));
+}
+
+inline DirectPath DirectPathLoader::GetBatch()
+{
+    return DirectPath(core::Check(OCI_DirPathLoaderGetBatch(*this)), GetHandle());
+}
+
+inline void DirectPathLoader::Submit(const DirectPath& batch)
+{
+    core::Check(OCI_DirPathLoaderSubmit(*this, batch));
+}
+
+inline void DirectPathLoader::Finish()
+{
+    core::Check(OCI_DirPathLoaderFinish(*this));
+}
+
+inline void DirectPathLoader::Abort()
+{
+    core::Check(OCI_DirPathLoaderAbort(*this));
+}
+
+inline unsigned int DirectPathLoader::GetWorkerCount() const
+{
+    return core::Check(OCI_DirPathLoaderGetWorkerCount(*this));
+}
+
+inline unsigned int DirectPathLoader::GetRowCount() const
+{
+    return core::Check(OCI_DirPathLoaderGetRowCount(*this));
+}
+
+inline unsigned int DirectPathLoader::GetRejectedCount() const
+{
+    return core::Check(OCI_DirPathLoaderGetRejectedCount(*this));
+}
+
+inline unsigned int DirectPathLoader::GetErrorCount() const
+{
+    return core::Check(OCI_DirPathLoaderGetErrorCount(*this));
+}
+
+inline int DirectPathLoader::GetErrorCode() const
+{
+    return core::Check(OCI_DirPathLoaderGetErrorCode(*this));
+}
+
+}
@@ -74,6 +74,15 @@ inline big_uint Environment::GetAllocatedBytes(AllocatedBytesFlags type)
     return core::Check(OCI_GetAllocatedBytes(type.GetValues()));
 }
 
+inline Environment::InitStatistics Environment::GetInitStatistics()
+{
+    InitStatistics stats;
+
+    core::Check(OCI_GetInitStatistics(&stats));
+
+    return stats;
+}
+
 inline bool Environment::Initialized()
 {
     return GetInstance()._initialized;
@@ -290,7 +299,7 @@ inline void Environment::SelfInitialize(EnvironmentFlags mode, const ostring& li
     _locker.SetAccessMode((_mode & Environment::Threaded) == Environment::Threaded);
 
     _callbacks.SetLocker(&_locker);
-    _handles.SetLocker(&_locker);
+    _handles.SetAccessMode((_mode & Environment::Threaded) == Environment::Threaded);
 
     _handle.Acquire(const_cast<AnyPointer>(core::Check(OCI_HandleGetEnvironment())), nullptr, nullptr, nullptr);
 
@@ -302,7 +311,7 @@ inline void Environment::SelfCleanup()
     _locker.SetAccessMode(false);
 
     _callbacks.SetLocker(nullptr);
-    _handles.SetLocker(nullptr);
+    _handles.SetAccessMode(false);
 
     _handle.Release();
 
@@ -91,6 +91,61 @@ inline Raw Lob<Raw, LobBinary>::Read(unsigned int length)
     return core::MakeRaw(buffer, length);
 }
 
+template<class T, int U>
+unsigned int Lob<T, U>::Read(typename T::value_type* buffer, unsigned int size)
+{
+    if (U == LobBinary)
+    {
+        return core::Check(OCI_LobRead(*this, static_cast<AnyPointer>(buffer), size));
+    }
+
+    /* the buffer must hold the characters in their client encoding and a null terminator */
+
+    unsigned int charCount = size / Environment::GetCharMaxSize();
+    unsigned int byteCount = 0;
+
+    if (charCount <= 1)
+    {
+        return 0;
+    }
+
+    charCount--;
+
+    if (!core::Check(OCI_LobRead2(*this, static_cast<AnyPointer>(buffer), &charCount, &byteCount)))
+    {
+        return 0;
+    }
+
+    return byteCount / sizeof(typename T::value_type);
+}
+
+template<class T, int U>
+unsigned int Lob<T, U>::Read(T& content, unsigned int length)
+{
+    const size_t offset = content.size();
+    const unsigned int size = U == LobBinary ? length : Environment::GetCharMaxSize() * (length + 1);
+
+    /* read in place at the end of the container, then drop the unused room */
+
+    content.resize(offset + size);
+
+    const unsigned int count = Read(&content[offset], size);
+
+    content.resize(offset + count);
+
+    return count;
+}
+
+#ifdef OCILIBPP_HAS_SPAN
+
+template<class T, int U>
+unsigned int Lob<T, U>::Read(std::span<typename T::value_type> buffer)
+{
+    return Read(buffer.data(), static_cast<unsigned int>(buffer.size()));
+}
+
+#endif
+
 template<class T, int U>
 unsigned int Lob<T, U>::Write(const T& content)
 {
@@ -99,12 +154,67 @@ unsigned int Lob<T, U>::Write(const T& content)
         return 0;
     }
 
+    return Write(&content[0], static_cast<unsigned int>(content.size()));
+}
+
+template<class T, int U>
+std::vector<unsigned int> Lob<T, U>::WriteMany(const std::vector<Lob>& lobs, const std::vector<T>& contents)
+{
+    const size_t count = lobs.size() < contents.size() ? lobs.size() : contents.size();
+
+    std::vector<OCI_Lob*> handles(count, nullptr);
+    std::vector<AnyPointer> buffers(count, nullptr);
+    std::vector<unsigned int> sizes(count, 0);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const T& content = contents[i];
+
+        /* empty contents are skipped by the C API, as with Write() */
+
+        handles[i] = lobs[i];
+        buffers[i] = content.empty() ? nullptr : static_cast<AnyPointer>(const_cast<typename T::value_type *>(&content[0]));
+        sizes[i]   = static_cast<unsigned int>(content.size());
+    }
+
+    if (count > 0)
+    {
+        core::Check(OCI_LobArrayWrite(&handles[0], static_cast<unsigned int>(count), &buffers[0], &sizes[0]));
+    }
+
+    return sizes;
+}
+
+template<class T, int U>
+void Lob<T, U>::Download(const Pool& pool, const ostring& sql, const ostring& filename,
+                         unsigned int workers, DownloadProgressProc handler)
+{
+    core::Check(OCI_LobDownload(pool, sql.c_str(), filename.c_str(), workers,
+                                handler != nullptr ? DownloadProgress : nullptr, &handler));
+}
+
+template<class T, int U>
+void Lob<T, U>::DownloadProgress(AnyPointer ctx, big_uint done, big_uint total)
+{
+    const DownloadProgressProc handler = *static_cast<DownloadProgressProc*>(ctx);
+
+    handler(done, total);
+}
+
+template<class T, int U>
+unsigned int Lob<T, U>::Write(const typename T::value_type* buffer, unsigned int size)
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+
     unsigned int res = 0;
     unsigned int charCount = 0;
-    unsigned int byteCount = static_cast<unsigned int>(content.size() * sizeof(typename T::value_type));
-    const AnyPointer buffer = static_cast<AnyPointer>(const_cast<typename T::value_type *>(&content[0]));
+    unsigned int byteCount = static_cast<unsigned int>(size * sizeof(typename T::value_type));
+    const AnyPointer data = static_cast<AnyPointer>(const_cast<typename T::value_type *>(buffer));
 
-    if (core::Check(OCI_LobWrite2(*this, buffer, &charCount, &byteCount)))
+    if (core::Check(OCI_LobWrite2(*this, data, &charCount, &byteCount)))
     {
         res = U == LobBinary ? byteCount : charCount;
     }
@@ -262,4 +372,18 @@ bool Lob<T, U>::operator != (const Lob<T, U>& other) const
     return !(*this == other);
 }
 
+template<class T, int U>
+LobInputStream<T, U>::LobInputStream(const Lob<T, U>& lob, unsigned int chunkSize) :
+    std::basic_istream<typename support::LobStreamCharResolver<U>::Type>(nullptr), _buffer(lob, chunkSize, false)
+{
+    this->init(&_buffer);
+}
+
+template<class T, int U>
+LobOutputStream<T, U>::LobOutputStream(const Lob<T, U>& lob, unsigned int chunkSize) :
+    std::basic_ostream<typename support::LobStreamCharResolver<U>::Type>(nullptr), _buffer(lob, chunkSize, true)
+{
+    this->init(&_buffer);
+}
+
 }
@@ -114,4 +114,38 @@ inline void Pool::SetStatementCacheSize(unsigned int value)
     core::Check(OCI_PoolSetStatementCacheSize(*this, value));
 }
 
+inline Pool::Statistics Pool::GetStatistics() const
+{
+    Statistics stats;
+
+    core::Check(OCI_PoolGetStatistics(*this, &stats));
+
+    return stats;
+}
+
+inline void Pool::ResetStatistics()
+{
+    core::Check(OCI_PoolResetStatistics(*this));
+}
+
+inline void Pool::StartKeeper(unsigned int target, unsigned int interval)
+{
+    core::Check(OCI_PoolStartKeeper(*this, target, interval));
+}
+
+inline void Pool::StopKeeper()
+{
+    core::Check(OCI_PoolStopKeeper(*this));
+}
+
+inline Connection Pool::GetThreadConnection()
+{
+    return Connection(core::Check(OCI_PoolGetThreadConnection(*this)), nullptr);
+}
+
+inline void Pool::ReleaseThreadConnection()
+{
+    core::Check(OCI_PoolReleaseThreadConnection(*this));
+}
+
 }
@@ -0,0 +1,97 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/types.hpp"
+
+// ReSharper disable CppClangTidyHicppUseEqualsDefault
+// ReSharper disable CppClangTidyModernizeUseEqualsDefault
+// ReSharper disable CppClangTidyPerformanceUnnecessaryValueParam
+
+namespace ocilib
+{
+
+inline PoolRouter::PoolRouter()
+{
+
+}
+
+inline void PoolRouter::Open()
+{
+    Release();
+
+    Acquire(core::Check(OCI_PoolRouterCreate()), reinterpret_cast<HandleFreeFunc>(OCI_PoolRouterFree),
+            nullptr, Environment::GetEnvironmentHandle());
+}
+
+inline void PoolRouter::Close()
+{
+    Release();
+}
+
+inline void PoolRouter::AddPool(unsigned int weight, const ostring& db, const ostring& user, const ostring& pwd,
+            Pool::PoolType poolType, unsigned int minSize, unsigned int maxSize, unsigned int increment,
+            Environment::SessionFlags sessionFlags)
+{
+    OCI_Pool* pool = core::Check(OCI_PoolCreate(db.c_str(), user.c_str(), pwd.c_str(), poolType,
+                                                sessionFlags.GetValues(), minSize, maxSize, increment));
+
+    try
+    {
+        core::Check(OCI_PoolRouterAddPool(*this, pool, weight));
+    }
+    catch (...)
+    {
+        OCI_PoolFree(pool);
+        throw;
+    }
+}
+
+inline unsigned int PoolRouter::GetCount() const
+{
+    return core::Check(OCI_PoolRouterGetCount(*this));
+}
+
+inline Connection PoolRouter::GetConnection(const ostring& sessionTag)
+{
+    return Connection(core::Check(OCI_PoolRouterGetConnection(*this, sessionTag.c_str())), GetHandle());
+}
+
+inline Pool::Statistics PoolRouter::GetStatistics(unsigned int index) const
+{
+    Pool::Statistics stats;
+
+    core::Check(OCI_PoolGetStatistics(core::Check(OCI_PoolRouterGetPool(*this, index)), &stats));
+
+    return stats;
+}
+
+inline unsigned int PoolRouter::GetBackOff() const
+{
+    return core::Check(OCI_PoolRouterGetBackOff(*this));
+}
+
+inline void PoolRouter::SetBackOff(unsigned int value)
+{
+    core::Check(OCI_PoolRouterSetBackOff(*this, value));
+}
+
+}
@@ -91,6 +91,78 @@ inline void Statement::ExecutePrepared()
     SetOutData();
 }
 
+inline bool Statement::Poll()
+{
+    unsigned int status = OCI_ASYNC_EXECUTING;
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+    support::BindsHolder *bindsHolder = GetBindsHolder(false);
+
+    try
+    {
+        status = core::Check(OCI_ExecutePoll(*this));
+    }
+    catch (...)
+    {
+        if (bindsHolder)
+        {
+            bindsHolder->FailAsync(std::current_exception());
+        }
+
+        throw;
+    }
+
+#else
+
+    status = core::Check(OCI_ExecutePoll(*this));
+
+#endif
+
+    if (OCI_ASYNC_EXECUTING == status)
+    {
+        return false;
+    }
+
+    SetOutData();
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+    /* fulfil the future returned by ExecuteAsync() */
+
+    if (bindsHolder)
+    {
+        bindsHolder->CompleteAsync(GetAffectedRows());
+    }
+
+#endif
+
+    return true;
+}
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+inline std::future<unsigned int> Statement::ExecuteAsync()
+{
+    ReleaseResultsets();
+    SetInData();
+
+    std::future<unsigned int> result = GetBindsHolder(true)->StartAsync();
+
+    core::Check(OCI_ExecuteAsync(*this));
+
+    return result;
+}
+
+inline std::future<unsigned int> Statement::ExecuteAsync(const ostring& sql)
+{
+    Prepare(sql);
+
+    return ExecuteAsync();
+}
+
+#endif
+
 template<class T>
 unsigned int Statement::ExecutePrepared(T callback)
 {
@@ -285,6 +357,28 @@ void Statement::BindVector2(M &method, const ostring& name, std::vector<T> &valu
     core::Check(res);
 }
 
+template<typename M, class T>
+void Statement::BindRange(M &method, const ostring& name, T* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    /* regular array binds are read by OCI up to the bind array size */
+
+    if (values && type == BindInfo::AsArray && count < GetBindArraySize())
+    {
+        Exception ex;
+
+        ex._pStatement = *this;
+        ex._pConnnection = OCI_StatementGetConnection(*this);
+        ex._type = Exception::OcilibError;
+        ex._errLib = OCI_ERR_BIND_ARRAY_SIZE;
+        ex.SetWhat((OTEXT("The range bound to '") + name + OTEXT("' is smaller than the bind array size")).c_str());
+
+        throw ex;
+    }
+
+    core::Check(method(*this, name.c_str(), values, type == BindInfo::AsPlSqlTable ? count : 0));
+    SetLastBindMode(mode);
+}
+
 template<>
 inline void Statement::Bind<bool>(const ostring& name, bool &value, BindInfo::BindDirection mode)
 {
@@ -574,6 +668,78 @@ inline void Statement::Bind<Number>(const ostring& name, std::vector<Number> &va
     BindVector1(OCI_BindArrayOfNumbers, name, values, mode, type);
 }
 
+template<>
+inline void Statement::BindInPlace<short>(const ostring& name, short* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfShorts, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<unsigned short>(const ostring& name, unsigned short* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfUnsignedShorts, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<int>(const ostring& name, int* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfInts, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<unsigned int>(const ostring& name, unsigned int* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfUnsignedInts, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<big_int>(const ostring& name, big_int* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfBigInts, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<big_uint>(const ostring& name, big_uint* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfUnsignedBigInts, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<float>(const ostring& name, float* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfFloats, name, values, count, mode, type);
+}
+
+template<>
+inline void Statement::BindInPlace<double>(const ostring& name, double* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindRange(OCI_BindArrayOfDoubles, name, values, count, mode, type);
+}
+
+template<class T>
+void Statement::BindInPlace(const ostring& name, std::vector<T> &values, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindInPlace<T>(name, values.empty() ? nullptr : &values[0], static_cast<unsigned int>(values.size()), mode, type);
+}
+
+#ifdef OCILIBPP_HAS_SPAN
+
+template<class T>
+void Statement::BindInPlace(const ostring& name, std::span<T> values, BindInfo::BindDirection mode, BindInfo::VectorType type)
+{
+    BindInPlace<T>(name, values.data(), static_cast<unsigned int>(values.size()), mode, type);
+}
+
+#endif
+
+inline void Statement::BindPackedStrings(const ostring& name, void* data, std::vector<unsigned int>& offsets, BindInfo::VectorType type)
+{
+    const unsigned int count = offsets.empty() ? 0 : static_cast<unsigned int>(offsets.size() - 1);
+
+    core::Check(OCI_BindArrayOfPackedStrings(*this, name.c_str(), data, offsets.empty() ? nullptr : &offsets[0], type == BindInfo::AsPlSqlTable ? count : 0));
+    SetLastBindMode(BindInfo::In);
+}
+
 template<class T>
 void Statement::Bind(const ostring& name, Collection<T> &value, BindInfo::BindDirection mode)
 {
@@ -0,0 +1,128 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/core.hpp"
+
+// ReSharper disable CppClangTidyHicppUseEqualsDefault
+// ReSharper disable CppClangTidyModernizeUseEqualsDefault
+
+namespace ocilib
+{
+    namespace core
+    {
+        template<class K, class V, std::size_t N>
+        ConcurrentHashMap<K, V, N>::ConcurrentHashMap()
+        {
+
+        }
+
+        template<class K, class V, std::size_t N>
+        ConcurrentHashMap<K, V, N>::~ConcurrentHashMap() noexcept
+        {
+            SILENT_CATCH(Clear());
+        }
+
+        template<class K, class V, std::size_t N>
+        void ConcurrentHashMap<K, V, N>::SetAccessMode(bool threaded)
+        {
+            for (auto& shard : _shards)
+            {
+                shard.locker.SetAccessMode(threaded);
+            }
+        }
+
+        template<class K, class V, std::size_t N>
+        typename ConcurrentHashMap<K, V, N>::Shard& ConcurrentHashMap<K, V, N>::GetShard(K key)
+        {
+            size_t hash = std::hash<K>()(key);
+
+            hash ^= (hash >> 7) ^ (hash >> 13);
+
+            return _shards[hash % N];
+        }
+
+        template<class K, class V, std::size_t N>
+        void ConcurrentHashMap<K, V, N>::Remove(K key)
+        {
+            Shard& shard = GetShard(key);
+
+            shard.locker.Lock();
+            shard.map.erase(key);
+            shard.locker.Unlock();
+        }
+
+        template<class K, class V, std::size_t N>
+        V ConcurrentHashMap<K, V, N>::Get(K key)
+        {
+            V value = 0;
+
+            Shard& shard = GetShard(key);
+
+            shard.locker.Lock();
+            typename std::unordered_map< K, V >::const_iterator it = shard.map.find(key);
+            if (it != shard.map.end())
+            {
+                value = it->second;
+            }
+            shard.locker.Unlock();
+
+            return value;
+        }
+
+        template<class K, class V, std::size_t N>
+        void ConcurrentHashMap<K, V, N>::Set(K key, V value)
+        {
+            Shard& shard = GetShard(key);
+
+            shard.locker.Lock();
+            shard.map[key] = value;
+            shard.locker.Unlock();
+        }
+
+        template<class K, class V, std::size_t N>
+        void ConcurrentHashMap<K, V, N>::Clear()
+        {
+            for (auto& shard : _shards)
+            {
+                shard.locker.Lock();
+                shard.map.clear();
+                shard.locker.Unlock();
+            }
+        }
+
+        template<class K, class V, std::size_t N>
+        size_t ConcurrentHashMap<K, V, N>::GetSize()
+        {
+            size_t size = 0;
+
+            for (auto& shard : _shards)
+            {
+                shard.locker.Lock();
+                size += shard.map.size();
+                shard.locker.Unlock();
+            }
+
+            return size;
+        }
+
+    }
+}
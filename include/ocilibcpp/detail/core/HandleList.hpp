@@ -0,0 +1,185 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/core.hpp"
+
+// ReSharper disable CppClangTidyHicppUseEqualsDefault
+// ReSharper disable CppClangTidyModernizeUseEqualsDefault
+// ReSharper disable CppClangTidyHicppUseAuto
+// ReSharper disable CppClangTidyModernizeUseAuto
+
+namespace ocilib
+{
+    namespace core
+    {
+        inline HandleList::HandleList() : _head(nullptr), _tail(nullptr), _size(0)
+        {
+
+        }
+
+        inline HandleList::~HandleList() noexcept
+        {
+            SILENT_CATCH(Release([](Handle*) {}))
+        }
+
+        inline void HandleList::Add(Handle* handle)
+        {
+            Lock();
+
+            if (handle->_list == nullptr)
+            {
+                handle->_list = this;
+                handle->_previous = _tail;
+                handle->_next = nullptr;
+
+                if (_tail)
+                {
+                    _tail->_next = handle;
+                }
+                else
+                {
+                    _head = handle;
+                }
+
+                _tail = handle;
+                _size++;
+            }
+
+            Unlock();
+        }
+
+        inline void HandleList::Remove(Handle* handle)
+        {
+            Lock();
+
+            if (handle->_list == this)
+            {
+                Unlink(handle);
+            }
+
+            Unlock();
+        }
+
+        inline size_t HandleList::GetSize()
+        {
+            Lock();
+            const size_t size = _size;
+            Unlock();
+
+            return size;
+        }
+
+        template<class P>
+        bool HandleList::FindIf(P predicate, Handle*& handle)
+        {
+            bool res = false;
+
+            Lock();
+
+            for (Handle* current = _head; current; current = current->_next)
+            {
+                if (predicate(current))
+                {
+                    handle = current;
+                    res = true;
+                    break;
+                }
+            }
+
+            Unlock();
+
+            return res;
+        }
+
+        template<class A>
+        void HandleList::ForEach(A action)
+        {
+            Lock();
+
+            for (Handle* current = _head; current; current = current->_next)
+            {
+                action(current);
+            }
+
+            Unlock();
+        }
+
+        template<class A>
+        void HandleList::Release(A action)
+        {
+            /* detach the whole chain at once and run the action on its
+               elements outside of the lock as they may remove themselves */
+
+            Lock();
+
+            Handle* current = _head;
+
+            for (Handle* handle = _head; handle; handle = handle->_next)
+            {
+                handle->_list = nullptr;
+            }
+
+            _head = _tail = nullptr;
+            _size = 0;
+
+            Unlock();
+
+            while (current)
+            {
+                Handle* next = current->_next;
+
+                current->_previous = current->_next = nullptr;
+
+                action(current);
+
+                current = next;
+            }
+        }
+
+        inline void HandleList::Unlink(Handle* handle)
+        {
+            if (handle->_previous)
+            {
+                handle->_previous->_next = handle->_next;
+            }
+            else
+            {
+                _head = handle->_next;
+            }
+
+            if (handle->_next)
+            {
+                handle->_next->_previous = handle->_previous;
+            }
+            else
+            {
+                _tail = handle->_previous;
+            }
+
+            handle->_list = nullptr;
+            handle->_previous = handle->_next = nullptr;
+
+            _size--;
+        }
+
+    }
+}
@@ -65,8 +65,7 @@ namespace ocilib
                 _parent->GetChildren().Remove(this);
             }
 
-            _children.ForEach(DeleteHandle);
-            _children.Clear();
+            _children.Release(DeleteHandle);
 
             _holders.SetLocker(nullptr);
             _children.SetLocker(nullptr);
@@ -149,7 +148,7 @@ namespace ocilib
         }
 
         template<class T>
-        ConcurrentList<Handle*>& HandleHolder<T>::SmartHandle::GetChildren()
+        HandleList& HandleHolder<T>::SmartHandle::GetChildren()
         {
             return _children;
         }
@@ -27,6 +27,9 @@ namespace ocilib
     namespace support
     {
         inline BindsHolder::BindsHolder(const ocilib::Statement& statement) : _statement(statement)
+#ifdef OCILIBPP_HAS_FUTURE
+            , _asyncPending(false)
+#endif
         {
 
         }
@@ -88,5 +91,35 @@ namespace ocilib
                 (*it)->SetInData();
             }
         }
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+        inline std::future<unsigned int> BindsHolder::StartAsync()
+        {
+            _asyncResult = std::promise<unsigned int>();
+            _asyncPending = true;
+
+            return _asyncResult.get_future();
+        }
+
+        inline void BindsHolder::CompleteAsync(unsigned int affectedRows)
+        {
+            if (_asyncPending)
+            {
+                _asyncPending = false;
+                _asyncResult.set_value(affectedRows);
+            }
+        }
+
+        inline void BindsHolder::FailAsync(std::exception_ptr exception)
+        {
+            if (_asyncPending)
+            {
+                _asyncPending = false;
+                _asyncResult.set_exception(exception);
+            }
+        }
+
+#endif
     }
 }
@@ -0,0 +1,172 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/support.hpp"
+
+namespace ocilib
+{
+    namespace support
+    {
+        template<class T, int U>
+        LobStreamBuffer<T, U>::LobStreamBuffer(const ocilib::Lob<T, U>& lob, unsigned int chunkSize, bool output) : _lob(lob), _chunkSize(0)
+        {
+            const unsigned int lobChunkSize = static_cast<unsigned int>(lob.GetChunkSize());
+
+            /* round trips are aligned on the lob chunk size */
+
+            _chunkSize = chunkSize > 0 ? chunkSize : lobChunkSize;
+
+            if (lobChunkSize > 0)
+            {
+                _chunkSize = ((_chunkSize + lobChunkSize - 1) / lobChunkSize) * lobChunkSize;
+            }
+
+            if (_chunkSize == 0)
+            {
+                _chunkSize = OCI_SIZE_BUFFER;
+            }
+
+            if (output)
+            {
+                /* room is needed for a multibyte sequence left over by a flush */
+
+                if (_chunkSize < Environment::GetCharMaxSize())
+                {
+                    _chunkSize = Environment::GetCharMaxSize();
+                }
+
+                _buffer.resize(_chunkSize);
+
+                this->setp(&_buffer[0], &_buffer[0] + _buffer.size());
+            }
+            else
+            {
+                /* character lobs are read with room for their client encoding and a null terminator */
+
+                _buffer.resize(U == LobBinary ? _chunkSize : Environment::GetCharMaxSize() * (_chunkSize + 1));
+            }
+        }
+
+        template<class T, int U>
+        LobStreamBuffer<T, U>::~LobStreamBuffer() noexcept
+        {
+            SILENT_CATCH(Flush())
+        }
+
+        template<class T, int U>
+        typename LobStreamBuffer<T, U>::IntType LobStreamBuffer<T, U>::underflow()
+        {
+            if (this->gptr() < this->egptr())
+            {
+                return TraitsType::to_int_type(*this->gptr());
+            }
+
+            CharType* data = &_buffer[0];
+
+            const unsigned int count = _lob.Read(reinterpret_cast<typename T::value_type*>(data), static_cast<unsigned int>(_buffer.size()));
+
+            if (count == 0)
+            {
+                return TraitsType::eof();
+            }
+
+            this->setg(data, data, data + count);
+
+            return TraitsType::to_int_type(*this->gptr());
+        }
+
+        template<class T, int U>
+        typename LobStreamBuffer<T, U>::IntType LobStreamBuffer<T, U>::overflow(IntType value)
+        {
+            if (this->pbase() == nullptr || !Flush())
+            {
+                return TraitsType::eof();
+            }
+
+            if (!TraitsType::eq_int_type(value, TraitsType::eof()))
+            {
+                *this->pptr() = TraitsType::to_char_type(value);
+                this->pbump(1);
+            }
+
+            return TraitsType::not_eof(value);
+        }
+
+        template<class T, int U>
+        int LobStreamBuffer<T, U>::sync()
+        {
+            return Flush() ? 0 : -1;
+        }
+
+        template<class T, int U>
+        bool LobStreamBuffer<T, U>::Flush()
+        {
+            const unsigned int count = static_cast<unsigned int>(this->pptr() - this->pbase());
+
+            unsigned int size = count;
+
+            /* with a UTF8 client charset, a sequence split by the end of the put area
+               is kept in the buffer and written by the next flush */
+
+            if (U != LobBinary && sizeof(CharType) == 1 && Environment::GetCharMaxSize() > 1)
+            {
+                const unsigned char* data = reinterpret_cast<const unsigned char*>(this->pbase());
+
+                unsigned int lead = count;
+
+                while (lead > 0 && count - lead < Environment::GetCharMaxSize() && (data[lead - 1] & 0xC0) == 0x80)
+                {
+                    lead--;
+                }
+
+                if (lead > 0)
+                {
+                    const unsigned char byte = data[lead - 1];
+
+                    const unsigned int length = (byte & 0xF8) == 0xF0 ? 4 :
+                                                (byte & 0xF0) == 0xE0 ? 3 :
+                                                (byte & 0xE0) == 0xC0 ? 2 : 1;
+
+                    if (lead - 1 + length > count)
+                    {
+                        size = lead - 1;
+                    }
+                }
+            }
+
+            if (size > 0)
+            {
+                _lob.Write(reinterpret_cast<const typename T::value_type*>(this->pbase()), size);
+            }
+
+            if (count > 0)
+            {
+                std::copy(this->pbase() + size, this->pptr(), this->pbase());
+
+                this->setp(this->pbase(), this->epptr());
+                this->pbump(static_cast<int>(count - size));
+            }
+
+            return true;
+        }
+    }
+}
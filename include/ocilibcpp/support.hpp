@@ -20,6 +20,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+
 #include "ocilibcpp/core.hpp"
 
 // ReSharper disable CppClangTidyModernizeUseNodiscard
@@ -208,6 +213,7 @@ namespace ocilib
        /**
         * @brief Internal usage.
         * Class owning bind objects allowing to set/get C data prior/after a statement execution
+        * and the result of a pending non blocking execution
         */ 
         class BindsHolder
         {
@@ -223,10 +229,64 @@ namespace ocilib
             void SetOutData();
             void SetInData();
 
+#ifdef OCILIBPP_HAS_FUTURE
+
+            std::future<unsigned int> StartAsync();
+            void CompleteAsync(unsigned int affectedRows);
+            void FailAsync(std::exception_ptr exception);
+
+#endif
+
         private:
 
             std::vector<BindObject*> _bindObjects;
             const ocilib::Statement& _statement;
+
+#ifdef OCILIBPP_HAS_FUTURE
+
+            std::promise<unsigned int> _asyncResult;
+            bool _asyncPending;
+
+#endif
+        };
+
+       /**
+        * @brief Internal usage.
+        * Allow resolving the character type of standard streams operating on a lob
+        */
+        template<int U> struct LobStreamCharResolver { typedef otext Type; };
+        template<> struct LobStreamCharResolver<OCI_BLOB> { typedef char Type; };
+
+       /**
+        * @brief Internal usage.
+        * Standard stream buffer reading or writing a lob content by chunks
+        */
+        template<class T, int U>
+        class LobStreamBuffer : public std::basic_streambuf<typename LobStreamCharResolver<U>::Type>
+        {
+        public:
+
+            typedef typename LobStreamCharResolver<U>::Type CharType;
+            typedef std::basic_streambuf<CharType> BaseType;
+            typedef typename BaseType::traits_type TraitsType;
+            typedef typename BaseType::int_type IntType;
+
+            LobStreamBuffer(const ocilib::Lob<T, U>& lob, unsigned int chunkSize, bool output);
+            virtual ~LobStreamBuffer() noexcept;
+
+        protected:
+
+            IntType underflow() override;
+            IntType overflow(IntType value) override;
+            int sync() override;
+
+        private:
+
+            bool Flush();
+
+            ocilib::Lob<T, U> _lob;
+            std::vector<CharType> _buffer;
+            unsigned int _chunkSize;
         };
     }
 }
@@ -483,6 +483,7 @@ namespace ocilib
         friend class Mutex;
         friend class Connection;
         friend class Pool;
+        friend class PoolRouter;
         friend class Subscription;
         friend class Dequeue;
         template<class>
@@ -556,7 +557,9 @@ namespace ocilib
             /** Enable support for multi-threading */
             Threaded = OCI_ENV_THREADED,
             /** Enable support for events related to subscriptions, HA and AQ notifications */
-            Events = OCI_ENV_EVENTS
+            Events = OCI_ENV_EVENTS,
+            /** Resolve OCI symbols on first use of their features (runtime import only) */
+            LazyBinding = OCI_ENV_LAZY_BINDING
         };
 
         /**
@@ -787,6 +790,16 @@ namespace ocilib
         */
         typedef core::Flags<AllocatedBytesValues> AllocatedBytesFlags;
 
+        /**
+         * @brief
+         * Library initialization timings snapshot
+         *
+         * @note
+         * See OCI_GetInitStatistics() for a description of each field
+         *
+         */
+        typedef OCI_InitStatistics InitStatistics;
+
         /**
         * @typedef HAHandlerProc
         *
@@ -877,6 +890,13 @@ namespace ocilib
         */
         static big_uint GetAllocatedBytes(AllocatedBytesFlags type);
 
+        /**
+        * @brief
+        * Return the timings of the library initialization phases
+        *
+        */
+        static InitStatistics GetInitStatistics();
+
         /**
         * @brief
         * Return true if the environment has been successfully initialized
@@ -1132,7 +1152,7 @@ namespace ocilib
         void SelfCleanup();
 
         core::Locker _locker;
-        core::ConcurrentMap<AnyPointer, core::Handle*>  _handles;
+        core::ConcurrentHashMap<AnyPointer, core::Handle*> _handles;
         core::ConcurrentMap<AnyPointer, CallbackPointer> _callbacks;
         EnvironmentHandle _handle;
         EnvironmentFlags _mode;
@@ -1357,6 +1377,16 @@ namespace ocilib
         */
         typedef core::Enum<PoolTypeValues> PoolType;
 
+        /**
+         * @brief
+         * Pool checkout statistics snapshot
+         *
+         * @note
+         * See OCI_PoolGetStatistics() for a description of each field
+         *
+         */
+        typedef OCI_PoolStatistics Statistics;
+
         /**
          * @brief
          * Default constructor
@@ -1550,6 +1580,169 @@ namespace ocilib
          *
          */
         void SetStatementCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Return a snapshot of the pool checkout statistics
+         *
+         * @note
+         * Checkout latencies are expressed in microseconds
+         *
+         */
+        Statistics GetStatistics() const;
+
+        /**
+         * @brief
+         * Reset the pool checkout statistics
+         *
+         */
+        void ResetStatistics();
+
+        /**
+         * @brief
+         * Start or update the pool health keeper
+         *
+         * @param target   - Number of connections/sessions to keep opened
+         * @param interval - Delay in seconds between two maintenance runs
+         *
+         * @note
+         * See OCI_PoolStartKeeper() for details
+         *
+         * @warning
+         * The environment must be initialized with Environment::Threaded
+         *
+         */
+        void StartKeeper(unsigned int target, unsigned int interval);
+
+        /**
+         * @brief
+         * Stop the pool health keeper
+         *
+         */
+        void StopKeeper();
+
+        /**
+         * @brief
+         * Return the connection bound to the calling thread
+         *
+         * @note
+         * The first call from a thread retrieves a connection from the pool and binds it to the thread.
+         * Subsequent calls from this thread return the same connection without locking.
+         * The connection returns to the pool when the thread exits, when ReleaseThreadConnection()
+         * is called from this thread or when the pool is closed.
+         *
+         * @note
+         * The returned object does not own the connection and does not return it to the pool
+         * when it goes out of scope. See OCI_PoolGetThreadConnection() for details
+         *
+         */
+        Connection GetThreadConnection();
+
+        /**
+         * @brief
+         * Return the connection bound to the calling thread to the pool
+         *
+         */
+        void ReleaseThreadConnection();
+    };
+
+    /**
+      * @brief
+      * A router balancing connection requests across several pools.
+      *
+      * This class wraps the OCILIB object handle OCI_PoolRouter and its related methods
+      *
+      */
+    class PoolRouter : public core::HandleHolder<OCI_PoolRouter*>
+    {
+    public:
+
+        /**
+         * @brief
+         * Default constructor
+         *
+         */
+        PoolRouter();
+
+        /**
+         * @brief
+         * Create the underlying pool router
+         *
+         */
+        void Open();
+
+        /**
+         * @brief
+         * Destroy the pool router and all the pools it owns
+         *
+         */
+        void Close();
+
+        /**
+         * @brief
+         * Create a pool owned by the router
+         *
+         * @param weight       - Pool relative weight (at least 1)
+         * @param db           - Oracle Service Name
+         * @param user         - Oracle User name
+         * @param pwd          - Oracle User password
+         * @param poolType     - Type of pool
+         * @param minSize      - minimum number of  connections/sessions that can be opened.
+         * @param maxSize      - maximum number of  connections/sessions that can be opened.
+         * @param increment    - next increment for connections/sessions to be opened
+         * @param sessionFlags - session Flags
+         *
+         * @note
+         * See OCI_PoolRouterAddPool() for details about weights
+         *
+         */
+        void AddPool(unsigned int weight, const ostring& db, const ostring& user, const ostring& pwd,
+            Pool::PoolType poolType, unsigned int minSize, unsigned int maxSize, unsigned int increment = 1,
+            Environment::SessionFlags sessionFlags = Environment::SessionDefault);
+
+        /**
+         * @brief
+         * Return the number of pools owned by the router
+         *
+         */
+        unsigned int GetCount() const;
+
+        /**
+         * @brief
+         * Get a connection from the most appropriate pool
+         *
+         * @param sessionTag  - Session user tag string
+         *
+         * @note
+         * See OCI_PoolRouterGetConnection() for details about how the pool is chosen
+         *
+         */
+        Connection GetConnection(const ostring& sessionTag = OTEXT(""));
+
+        /**
+         * @brief
+         * Return a snapshot of the checkout statistics of a pool owned by the router
+         *
+         * @param index - Pool index (starting at 1)
+         *
+         */
+        Pool::Statistics GetStatistics(unsigned int index) const;
+
+        /**
+         * @brief
+         * Return the delay in seconds during which a pool that failed is used only as a last resort
+         *
+         */
+        unsigned int GetBackOff() const;
+
+        /**
+         * @brief
+         * Set the delay in seconds during which a pool that failed is used only as a last resort
+         *
+         * @param value - Delay in seconds
+         *
+         */
+        void SetBackOff(unsigned int value);
     };
 
     /**
@@ -1567,6 +1760,7 @@ namespace ocilib
         friend class File;
         friend class Timestamp;
         friend class Pool;
+        friend class PoolRouter;
         friend class Object;
         friend class TypeInfo;
         friend class Reference;
@@ -1785,6 +1979,28 @@ namespace ocilib
          */
         void Open(const ostring& db, const ostring& user, const ostring& pwd, Environment::SessionFlags sessionFlags = Environment::SessionDefault);
 
+        /**
+         * @brief
+         * Create several physical connections to an Oracle database server concurrently
+         *
+         * @param db           - Oracle Service Name
+         * @param user         - Oracle User name
+         * @param pwd          - Oracle User password
+         * @param count        - Number of connections to create
+         * @param errors       - Error code of each connection (0 on success)
+         * @param sessionFlags - Session Flags
+         *
+         * @return
+         * A vector of 'count' connections. Connections that could not be established are null
+         * and their error code is stored at the same index in 'errors'
+         *
+         * @note
+         * See OCI_ConnectionCreateMany() for details
+         *
+         */
+        static std::vector<Connection> OpenMany(const ostring& db, const ostring& user, const ostring& pwd, unsigned int count,
+                                                std::vector<int>& errors, Environment::SessionFlags sessionFlags = Environment::SessionDefault);
+
         /**
          * @brief
          * Close the physical connection to the DB server
@@ -2197,6 +2413,75 @@ namespace ocilib
          */
         void SetStatementCacheSize(unsigned int value);
 
+        /**
+         * @brief
+         * Return the maximum number of statements kept by the OCILIB prepared statements cache
+         *
+         * @note
+         * Default value is 20
+         *
+         */
+        unsigned int GetPreparedCacheSize() const;
+
+        /**
+         * @brief
+         * Set the maximum number of statements kept by the OCILIB prepared statements cache
+         *
+         * @param value - maximum number of statements in the cache (0 disables the cache)
+         *
+         */
+        void SetPreparedCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Return the number of prepared statements cache hits
+         *
+         */
+        unsigned int GetPreparedCacheHits() const;
+
+        /**
+         * @brief
+         * Return the number of prepared statements cache misses
+         *
+         */
+        unsigned int GetPreparedCacheMisses() const;
+
+        /**
+         * @brief
+         * Return the maximum number of temporary lobs kept by the connection for reuse
+         *
+         * @note
+         * Default value is 0 (temporary lobs are not recycled)
+         *
+         */
+        unsigned int GetTemporaryLobCacheSize() const;
+
+        /**
+         * @brief
+         * Set the maximum number of temporary lobs kept by the connection for reuse
+         *
+         * @param value - maximum number of lobs in the cache (0 disables the cache)
+         *
+         * @note
+         * See OCI_SetTemporaryLobCacheSize() for details
+         *
+         */
+        void SetTemporaryLobCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Return the number of temporary lobs cache hits
+         *
+         */
+        unsigned int GetTemporaryLobCacheHits() const;
+
+        /**
+         * @brief
+         * Return the number of temporary lobs cache misses
+         *
+         */
+        unsigned int GetTemporaryLobCacheMisses() const;
+
         /**
          * @brief
          * Return the default LOB prefetch buffer size for the connection
@@ -4004,6 +4289,18 @@ namespace ocilib
 
     public:
 
+        /**
+         * @typedef DownloadProgressProc
+         *
+         * @brief
+         * User callback for lob download progress
+         *
+         * @param done  - Number of bytes downloaded so far
+         * @param total - Lob size in bytes
+         *
+         */
+        typedef void (*DownloadProgressProc) (big_uint done, big_uint total);
+
         /**
         * @brief
         * Create an empty null Lob instance
@@ -4035,6 +4332,64 @@ namespace ocilib
         */
         T Read(unsigned int length);
 
+        /**
+        * @brief
+        * Read a portion of a lob into a caller buffer
+        *
+        * @param buffer - Buffer receiving the content
+        * @param size   - Buffer size in characters or bytes
+        *
+        * @note
+        * No intermediate buffer is allocated.
+        * For character lobs, at most (size / Environment::GetCharMaxSize()) - 1 characters
+        * are read as the buffer must be able to hold them in their client encoding
+        * and a null terminator.
+        *
+        * @return
+        * Number of characters or bytes stored into the buffer
+        *
+        */
+        unsigned int Read(typename T::value_type* buffer, unsigned int size);
+
+        /**
+        * @brief
+        * Read a portion of a lob and append it to the given content
+        *
+        * @param content - Container receiving the content
+        * @param length  - Maximum number of characters or bytes to read
+        *
+        * @note
+        * The content is read in place at the end of the container, that is first grown by
+        * length elements for binary lobs and by Environment::GetCharMaxSize() * (length + 1)
+        * elements for character lobs, to hold the characters in their client encoding and a
+        * null terminator. No allocation happens if the container capacity is at least its
+        * size plus that amount.
+        *
+        * @return
+        * Number of characters or bytes appended to the container
+        *
+        */
+        unsigned int Read(T& content, unsigned int length);
+
+#ifdef OCILIBPP_HAS_SPAN
+
+        /**
+        * @brief
+        * Read a portion of a lob into a caller span
+        *
+        * @param buffer - Span receiving the content
+        *
+        * @note
+        * See Read(typename T::value_type*, unsigned int) for details
+        *
+        * @return
+        * Number of characters or bytes stored into the span
+        *
+        */
+        unsigned int Read(std::span<typename T::value_type> buffer);
+
+#endif
+
         /**
         * @brief
         * Write the given content at the current position within the lob
@@ -4047,6 +4402,58 @@ namespace ocilib
         */
         unsigned int Write(const T& content);
 
+        /**
+        * @brief
+        * Write the given buffer at the current position within the lob
+        *
+        * @param buffer - Buffer holding the content to write
+        * @param size   - Buffer size in characters or bytes
+        *
+        * @return
+        * Number of character or bytes written into the lob
+        *
+        */
+        unsigned int Write(const typename T::value_type* buffer, unsigned int size);
+
+        /**
+        * @brief
+        * Write each given content into the lob at the same index in a single server round trip
+        *
+        * @param lobs     - Lobs to write into
+        * @param contents - Contents to write
+        *
+        * @return
+        * Number of character or bytes written into each lob
+        *
+        * @note
+        * Only the first min(lobs.size(), contents.size()) lobs are written
+        *
+        * @note
+        * See OCI_LobArrayWrite() for details
+        *
+        */
+        static std::vector<unsigned int> WriteMany(const std::vector<Lob>& lobs, const std::vector<T>& contents);
+
+        /**
+        * @brief
+        * Download a BLOB into a file using several pooled sessions concurrently
+        *
+        * @param pool     - Pool providing the sessions
+        * @param sql      - Query returning the BLOB in the first column of its first row
+        * @param filename - Destination file name
+        * @param workers  - Maximum number of sessions reading the lob concurrently
+        * @param handler  - Progress callback (optional)
+        *
+        * @warning
+        * The progress callback is called from worker threads and must not throw
+        *
+        * @note
+        * See OCI_LobDownload() for details
+        *
+        */
+        static void Download(const Pool& pool, const ostring& sql, const ostring& filename,
+                             unsigned int workers, DownloadProgressProc handler = nullptr);
+
         /**
         * @brief
         * Append the given content to the lob
@@ -4270,6 +4677,8 @@ namespace ocilib
 
         bool Equals(const Lob& other) const;
 
+        static void DownloadProgress(AnyPointer ctx, big_uint done, big_uint total);
+
         Lob(OCI_Lob* pLob, core::Handle* parent = nullptr);
 
     };
@@ -4307,6 +4716,109 @@ namespace ocilib
     */
     typedef Lob<Raw, LobBinary> Blob;
 
+    /**
+    *
+    * @brief
+    * Standard input stream reading a lob content
+    *
+    * Characters are read from the current position within the lob by chunks.
+    * BLOB content is read as char.
+    *
+    * @note
+    * The chunk size is rounded up to a multiple of the lob chunk size (see Lob::GetChunkSize()).
+    *
+    */
+    template<class T, int U>
+    class LobInputStream : public std::basic_istream<typename support::LobStreamCharResolver<U>::Type>
+    {
+    public:
+
+        /**
+        * @brief
+        * Constructor
+        *
+        * @param lob       - Lob to read from
+        * @param chunkSize - Number of characters or bytes read per round trip (0 for the lob chunk size)
+        *
+        * @warning
+        * The lob position must not be changed by other means while the stream is used
+        *
+        */
+        LobInputStream(const Lob<T, U>& lob, unsigned int chunkSize = 0);
+
+    private:
+
+        support::LobStreamBuffer<T, U> _buffer;
+    };
+
+    /**
+    *
+    * @brief
+    * Standard output stream writing a lob content
+    *
+    * Characters are written at the current position within the lob by chunks.
+    * BLOB content is written as char.
+    *
+    * @note
+    * The chunk size is rounded up to a multiple of the lob chunk size (see Lob::GetChunkSize()).
+    * Pending characters are written when the stream is flushed or destroyed.
+    * With a UTF8 client charset, a multibyte sequence split by a chunk boundary is
+    * written with the next chunk.
+    *
+    */
+    template<class T, int U>
+    class LobOutputStream : public std::basic_ostream<typename support::LobStreamCharResolver<U>::Type>
+    {
+    public:
+
+        /**
+        * @brief
+        * Constructor
+        *
+        * @param lob       - Lob to write into
+        * @param chunkSize - Number of characters or bytes written per round trip (0 for the lob chunk size)
+        *
+        * @warning
+        * The lob position must not be changed by other means while the stream is used
+        *
+        */
+        LobOutputStream(const Lob<T, U>& lob, unsigned int chunkSize = 0);
+
+    private:
+
+        support::LobStreamBuffer<T, U> _buffer;
+    };
+
+    /**
+    * @brief Input stream reading a CLOB
+    */
+    typedef LobInputStream<ostring, LobCharacter> ClobInputStream;
+
+    /**
+    * @brief Output stream writing a CLOB
+    */
+    typedef LobOutputStream<ostring, LobCharacter> ClobOutputStream;
+
+    /**
+    * @brief Input stream reading a NCLOB
+    */
+    typedef LobInputStream<ostring, LobNationalCharacter> NClobInputStream;
+
+    /**
+    * @brief Output stream writing a NCLOB
+    */
+    typedef LobOutputStream<ostring, LobNationalCharacter> NClobOutputStream;
+
+    /**
+    * @brief Input stream reading a BLOB
+    */
+    typedef LobInputStream<Raw, LobBinary> BlobInputStream;
+
+    /**
+    * @brief Output stream writing a BLOB
+    */
+    typedef LobOutputStream<Raw, LobBinary> BlobOutputStream;
+
     /**
      *
      * @brief
@@ -5726,35 +6238,82 @@ namespace ocilib
         * unnecessary server round trips and less performance
         *
         */
-        void Parse(const ostring& sql);
+        void Parse(const ostring& sql);
+
+        /**
+        * @brief
+        * Prepare a SQL statement or PL/SQL block.
+        *
+        * @param sql  - SQL order or PL/SQL block
+        *
+        * @note
+        * With version 1.3.0 and above, do not call this function for fetched statements (REF cursors)
+        *
+        */
+        void Prepare(const ostring& sql);
+
+        /**
+        * @brief
+        * Execute a prepared SQL statement or PL/SQL block.
+        *
+        */
+        void ExecutePrepared();
+
+        /**
+        * @brief
+        * Prepare and execute a SQL statement or PL/SQL block.
+        *
+        * @param sql  - SQL order - PL/SQL block
+        *
+        */
+        void Execute(const ostring& sql);
 
         /**
         * @brief
-        * Prepare a SQL statement or PL/SQL block.
+        * Poll a pending non blocking execution
         *
-        * @param sql  - SQL order or PL/SQL block
+        * @return
+        * true if the execution has completed otherwise false if it is still executing on the server
         *
         * @note
-        * With version 1.3.0 and above, do not call this function for fetched statements (REF cursors)
+        * See OCI_ExecuteAsync() for details about non blocking executions
         *
         */
-        void Prepare(const ostring& sql);
+        bool Poll();
+
+#ifdef OCILIBPP_HAS_FUTURE
 
         /**
         * @brief
-        * Execute a prepared SQL statement or PL/SQL block.
+        * Start executing the prepared SQL statement or PL/SQL block without blocking
+        *
+        * @return
+        * A future holding the number of affected rows
+        *
+        * @note
+        * The execution is driven by calling Poll() (e.g. from an event loop) until it returns true.
+        * The returned future becomes ready when Poll() reports the completion (or an error),
+        * so waiting on it without polling the statement from elsewhere never returns.
+        *
+        * @note
+        * While the execution is pending, no other call can be made on the statement connection.
         *
         */
-        void ExecutePrepared();
+        std::future<unsigned int> ExecuteAsync();
 
         /**
         * @brief
-        * Prepare and execute a SQL statement or PL/SQL block.
+        * Prepare and start executing a SQL statement or PL/SQL block without blocking
         *
         * @param sql  - SQL order - PL/SQL block
         *
+        * @note
+        * See ExecuteAsync()
+        *
         */
-        void Execute(const ostring& sql);
+        std::future<unsigned int> ExecuteAsync(const ostring& sql);
+
+#endif
 
         /**
         * @brief
@@ -6171,6 +6730,104 @@ namespace ocilib
         template<class T, class U>
         void Bind(const ostring& name, std::vector<T>& values, U extraInfo, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
 
+        /**
+        * @brief
+        * Bind a vector of host variables in place, without intermediate buffer
+        *
+        * @tparam T - C++ type of the host variables
+        *
+        * @param name   - Bind name
+        * @param values - Vector of host variables
+        * @param mode   - bind direction mode
+        * @param type   - vector type (regular array or PL/SQL table)
+        *
+        * @note
+        * Unlike Bind(), the vector memory is directly given to OCI.
+        * Thus, values are not copied before and after each execution.
+        *
+        * @warning
+        * This method is only available for types having the same memory representation in C and C++:
+        * short, unsigned short, int, unsigned int, big_int, big_uint, float and double.
+        *
+        * @warning
+        * The vector must not be resized after this call as long as the bind is used.
+        * For regular arrays, it must hold at least GetBindArraySize() elements.
+        *
+        */
+        template<class T>
+        void BindInPlace(const ostring& name, std::vector<T>& values, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
+
+        /**
+        * @brief
+        * Bind a range of host variables in place, without intermediate buffer
+        *
+        * @tparam T - C++ type of the host variables
+        *
+        * @param name   - Bind name
+        * @param values - Pointer to the first host variable
+        * @param count  - Number of host variables in the range
+        * @param mode   - bind direction mode
+        * @param type   - vector type (regular array or PL/SQL table)
+        *
+        * @note
+        * See BindInPlace() for supported types and restrictions.
+        *
+        * @note
+        * For regular arrays, an exception is thrown if count is smaller than the
+        * bind array size, as OCI reads as many elements as the bind array size.
+        *
+        * @warning
+        * The range must remain valid as long as the bind is used.
+        *
+        */
+        template<class T>
+        void BindInPlace(const ostring& name, T* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
+
+#ifdef OCILIBPP_HAS_SPAN
+
+        /**
+        * @brief
+        * Bind a span of host variables in place, without intermediate buffer
+        *
+        * @tparam T - C++ type of the host variables
+        *
+        * @param name   - Bind name
+        * @param values - Span of host variables
+        * @param mode   - bind direction mode
+        * @param type   - vector type (regular array or PL/SQL table)
+        *
+        * @note
+        * See BindInPlace() for supported types and restrictions.
+        *
+        */
+        template<class T>
+        void BindInPlace(const ostring& name, std::span<T> values, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
+
+#endif
+
+        /**
+        * @brief
+        * Bind an input vector of strings packed in a single contiguous buffer
+        *
+        * @param name    - Bind name
+        * @param data    - Buffer holding all string elements one after the other
+        * @param offsets - Elements offsets (in bytes) within the buffer
+        * @param type    - vector type (regular array or PL/SQL table)
+        *
+        * @note
+        * Element i starts at offsets[i] and its length is offsets[i + 1] - offsets[i].
+        * Thus the number of elements is offsets.size() - 1.
+        * No copy or conversion is performed: strings must be encoded in the client charset.
+        *
+        * @note
+        * See OCI_BindArrayOfPackedStrings() for details.
+        *
+        * @warning
+        * Buffer and offsets must remain valid and unchanged in size as long as the bind is used.
+        *
+        */
+        void BindPackedStrings(const ostring& name, void* data, std::vector<unsigned int>& offsets, BindInfo::VectorType type = BindInfo::AsArray);
+
         /**
         * @brief
         * Register a host variable as an output for a column present in a SQL RETURNING INTO  clause
@@ -6467,6 +7124,9 @@ namespace ocilib
         template<typename M, class T, class U>
         void BindVector2(M& method, const ostring& name, std::vector<T>& values, BindInfo::BindDirection mode, U subType, BindInfo::VectorType type);
 
+        template<typename M, class T>
+        void BindRange(M& method, const ostring& name, T* values, unsigned int count, BindInfo::BindDirection mode, BindInfo::VectorType type);
+
         template<typename T>
         unsigned int Fetch(T callback);
 
@@ -8650,13 +9310,16 @@ namespace ocilib
          *
          * @param typeInfo  - Table type info object
          * @param nbCols    - Number of columns to load
-         * @param nbRows    - Maximum of rows to handle per load operation
+         * @param nbRows    - Maximum of rows to handle per load operation (0 for automatic sizing)
          * @param partition - Partition name
          *
          * @note
          * The partition name is not mandatory
          *
          * @note
+         * See OCI_DirPathCreate() for details about automatic sizing
+         *
+         * @note
          * Parameter 'nbRows' is ignored for Oracle 8i. Prior to Oracle 9i, it's the
          * OCI client that decides of the number of rows to process per convert/load calls.
          * From Oracle 9i, OCI allows application to specify this value. Note that, the
@@ -8718,6 +9381,68 @@ namespace ocilib
         template<class T>
         void SetEntry(unsigned int rowIndex, unsigned int colIndex, const T& value, bool complete = true);
 
+        /**
+         * @brief
+         * Set the values of a range of rows for the given column from the given vector
+         *
+         * @tparam T - type of data to set (only supported types are ostring and Raw)
+         *
+         * @param rowIndex  - Index of the first row to set
+         * @param colIndex  - Column index
+         * @param values    - Values to set for rows [rowIndex, rowIndex + values.size())
+         *
+         * @note
+         * Rows and columns indexes start at 1.
+         *
+         * @note
+         * All values are set with a single call to the C API (see OCI_DirPathSetEntries())
+         *
+         */
+        template<class T>
+        void SetEntries(unsigned int rowIndex, unsigned int colIndex, const std::vector<T>& values);
+
+        /**
+         * @brief
+         * Set the values of a range of rows for the given column from the given vectors
+         *
+         * @tparam T - type of data to set (only supported types are ostring and Raw)
+         *
+         * @param rowIndex  - Index of the first row to set
+         * @param colIndex  - Column index
+         * @param values    - Values to set for rows [rowIndex, rowIndex + values.size())
+         * @param nulls     - Null indicators of the values
+         *
+         * @note
+         * Rows and columns indexes start at 1.
+         *
+         * @note
+         * All values are set with a single call to the C API (see OCI_DirPathSetEntries())
+         *
+         */
+        template<class T>
+        void SetEntries(unsigned int rowIndex, unsigned int colIndex, const std::vector<T>& values, const std::vector<bool>& nulls);
+
+        /**
+         * @brief
+         * Set the value of the given row/column array entry by reference
+         *
+         * @param rowIndex  - Row index
+         * @param colIndex  - Column index
+         * @param value     - Pointer to the value to set
+         * @param size      - Size in bytes of the input value
+         * @param complete  - Is the entry content fully provided ?
+         *
+         * @note
+         * The value is not copied and is passed as is to OCI when rows are converted.
+         * Thus, it must be provided in the column expected format and must remain valid
+         * until the row has been converted.
+         *
+         * @note
+         * Refer to the C API function OCI_DirPathSetEntryByRef() for more details
+         *
+         */
+        void SetEntryByRef(unsigned int rowIndex, unsigned int colIndex, const void* value, unsigned int size, bool complete = true);
+
         /**
          * @brief
          * Reset internal arrays and streams to prepare another load
@@ -8770,6 +9495,21 @@ namespace ocilib
          */
         DirectPath::Result Load();
 
+        /**
+         * @brief
+         * Load the content of a delimited text file (e.g. CSV file)
+         *
+         * @param filename  - Path of the file to load
+         * @param delimiter - Fields delimiter
+         * @param quote     - Fields quote character (0 if fields are not quoted)
+         * @param skipLines - Number of non empty lines to skip at the beginning of the file
+         *
+         * @note
+         * See OCI_DirPathLoadFile() for details
+         *
+         */
+        void LoadFile(const ostring& filename, otext delimiter = OTEXT(','), otext quote = OTEXT('"'), unsigned int skipLines = 0);
+
         /**
          * @brief
          * Terminate a direct path operation and commit changes into the database
@@ -8911,6 +9651,26 @@ namespace ocilib
          */
         void SetParallel(bool value);
 
+        /**
+         * @brief
+         * Set the pipelined loading mode
+         *
+         * @param value - enable/disable pipelined mode
+         *
+         * @note
+         * When enabled, Load() loads the converted rows in background and returns
+         * immediately, so next rows can be converted while previous ones are loaded.
+         * Load() results and errors then refer to the previously submitted rows.
+         *
+         * @note
+         * Refer to the C API function OCI_DirPathSetPipelined() for more details
+         *
+         * @warning
+         * This mode requires the environment to be initialized with Environment::Threaded
+         *
+         */
+        void SetPipelined(bool value);
+
         /**
          * @brief
          * Set the logging mode for the loading operation
@@ -8949,7 +9709,8 @@ namespace ocilib
          * @param value - Buffer size
          *
          * @note
-         * Default value is 64KB.
+         * Default value is 64KB, or 1MB with automatic sizing.
+         * With automatic sizing, the number of rows per stream is derived from this size.
          *
          */
         void SetBufferSize(unsigned int value);
@@ -9033,6 +9794,148 @@ namespace ocilib
          */
 
         unsigned int GetErrorRow();
+
+    private:
+
+        friend class DirectPathLoader;
+
+        DirectPath(OCI_DirPath* pDirPath, core::Handle* parent);
+    };
+
+    /**
+     * @brief
+     * Direct path loader spreading the load of a table over several sessions
+     *
+     * This class wraps the OCILIB object handle OCI_DirPathLoader and its related methods
+     *
+     * @note
+     * See OCI_DirPathLoaderCreate() for details
+     *
+     */
+    class DirectPathLoader : public core::HandleHolder<OCI_DirPathLoader*>
+    {
+    public:
+
+        /**
+         * @brief
+         * Constructor
+         *
+         * @param typeInfo  - Table type info object
+         * @param nbCols    - Number of columns to load
+         * @param nbRows    - Maximum of rows to handle per batch
+         * @param nbWorkers - Number of sessions loading the table
+         * @param partition - Partition name
+         *
+         * @note
+         * The environment must be initialized with Environment::Threaded
+         *
+         */
+        DirectPathLoader(const TypeInfo& typeInfo, unsigned int nbCols, unsigned int nbRows,
+                         unsigned int nbWorkers, const ostring& partition = OTEXT(""));
+
+        /**
+         * @brief
+         * Describe a column to load for all sessions
+         *
+         * @param colIndex - Column index
+         * @param name     - Column name
+         * @param maxSize  - Maximum input value size for a column entry
+         * @param format   - Date or numeric format to use
+         *
+         * @note
+         * See DirectPath::SetColumn() for details
+         *
+         */
+        void SetColumn(unsigned int colIndex, const ostring& name, unsigned int maxSize, const ostring& format = OTEXT(""));
+
+        /**
+         * @brief
+         * Set the conversion mode of all sessions
+         *
+         * @param value - Conversion mode
+         *
+         */
+        void SetConversionMode(DirectPath::ConversionMode value);
+
+        /**
+         * @brief
+         * Prepare the direct path loads of all sessions
+         *
+         */
+        void Prepare();
+
+        /**
+         * @brief
+         * Return the direct path object of the next session to fill with rows
+         *
+         * @note
+         * The returned object must be filled with rows and then passed to Submit().
+         * It must not be converted, loaded or finished by the application.
+         *
+         */
+        DirectPath GetBatch();
+
+        /**
+         * @brief
+         * Submit a batch of rows to be converted and loaded in background
+         *
+         * @param batch - Direct path object returned by GetBatch()
+         *
+         * @note
+         * Errors raised while processing a batch are reported by GetErrorCount()
+         * and GetErrorCode()
+         *
+         */
+        void Submit(const DirectPath& batch);
+
+        /**
+         * @brief
+         * Wait for all submitted batches and terminate the loads of all sessions
+         *
+         */
+        void Finish();
+
+        /**
+         * @brief
+         * Wait for all submitted batches and abort the loads of all sessions
+         *
+         */
+        void Abort();
+
+        /**
+         * @brief
+         * Return the number of sessions
+         *
+         */
+        unsigned int GetWorkerCount() const;
+
+        /**
+         * @brief
+         * Return the number of rows successfully loaded by all sessions so far
+         *
+         */
+        unsigned int GetRowCount() const;
+
+        /**
+         * @brief
+         * Return the number of rows rejected by all sessions so far
+         *
+         */
+        unsigned int GetRejectedCount() const;
+
+        /**
+         * @brief
+         * Return the number of batches during which an error has been raised
+         *
+         */
+        unsigned int GetErrorCount() const;
+
+        /**
+         * @brief
+         * Return the code of the last error raised while processing a batch
+         *
+         */
+        int GetErrorCode() const;
     };
 
 
@@ -425,7 +425,7 @@ boolean BindAllocateBuffers
                 (OCI_CDT_LONG    != bnd->type)  &&
                 (OCI_CDT_BOOLEAN != bnd->type)  &&
                 (OCI_CDT_NUMERIC != bnd->type || SQLT_VNU == bnd->code) &&
-                (OCI_CDT_TEXT    != bnd->type || Env.use_wide_char_conv))
+                (OCI_CDT_TEXT    != bnd->type || (Env.use_wide_char_conv && SQLT_CHR != bnd->code)))
             {
                 bnd->alloc = TRUE;
 
@@ -635,6 +635,22 @@ boolean BindPerformBinding
             CallbackOutBind
         )
     }
+    else if (OCI_CDT_TEXT == bnd->type && SQLT_CHR == bnd->code)
+    {
+        /* packed strings : elements are provided one by one at execute time */
+
+        CHECK_OCI
+        (
+            bnd->stmt->con->err,
+            OCIBindDynamic,
+            (OCIBind *)bnd->buffer.handle,
+            bnd->stmt->con->err,
+            (dvoid *)bnd,
+            CallbackInPackedString,
+            (dvoid *)NULL,
+            NULL
+        )
+    }
 
     SET_SUCCESS()
 
@@ -851,7 +867,7 @@ OCI_Bind* BindCreate
             lg->maxsize *= (unsigned int) sizeof(dbtext);
         }
     }
-    else if (OCI_BIND_OUTPUT == mode)
+    else if (OCI_BIND_OUTPUT == mode || (OCI_CDT_TEXT == bnd->type && SQLT_CHR == bnd->code))
     {
         exec_mode = OCI_DATA_AT_EXEC;
     }
@@ -100,6 +100,49 @@ sb4 CallbackInBind
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * CallbackInPackedString
+ * --------------------------------------------------------------------------------------------- */
+
+sb4 CallbackInPackedString
+(
+    dvoid   *ictxp,
+    OCIBind *bindp,
+    ub4      iter,
+    ub4      index,
+    dvoid  **bufpp,
+    ub4     *alenp,
+    ub1     *piecep,
+    dvoid  **indp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ sb4, OCI_ERROR,
+        /* context */ OCI_IPC_BIND, ictxp
+    )
+
+    OCI_Bind *bnd = (OCI_Bind *) ictxp;
+
+    OCI_NOT_USED(bindp)
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+
+    /* for DML array executions, only iter moves while for PL/SQL tables,
+       only index does. Thus their sum gives the current element position */
+
+    const ub4 i = iter + index;
+
+    *bufpp  = (dvoid *) (((ub1 *) bnd->input) + bnd->offsets[i]);
+    *alenp  = (ub4    ) (bnd->offsets[i + 1] - bnd->offsets[i]);
+    *indp   = (dvoid *) &bnd->buffer.inds[i];
+    *piecep = (ub1    ) OCI_ONE_PIECE;
+
+    SET_RETVAL(OCI_CONTINUE)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ProcOutBind
  * --------------------------------------------------------------------------------------------- */
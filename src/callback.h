@@ -35,6 +35,18 @@ sb4 CallbackInBind
     dvoid  **indp
 );
 
+sb4 CallbackInPackedString
+(
+    dvoid   *ictxp,
+    OCIBind *bindp,
+    ub4      iter,
+    ub4      index,
+    dvoid  **bufpp,
+    ub4     *alenp,
+    ub1     *piecep,
+    dvoid  **indp
+);
+
 sb4 CallbackOutBind
 (
     dvoid   *octxp,
@@ -45,6 +45,8 @@ OCI_Coll * CollectionInitialize
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
+    CHECK_SYMBOLS(OCI_SYM_COLLECTION)
+
     ALLOC_DATA(OCI_IPC_COLLECTION, coll, 1);
 
     coll->con    = con;
@@ -25,9 +25,12 @@
 #include "error.h"
 #include "format.h"
 #include "list.h"
+#include "lob.h"
 #include "macros.h"
+#include "mutex.h"
 #include "statement.h"
 #include "strings.h"
+#include "thread.h"
 #include "timestamp.h"
 #include "transaction.h"
 #include "typeinfo.h"
@@ -48,6 +51,12 @@ static const unsigned int TimeoutTypeValues[] =
     OCI_NTO_CALL
 };
 
+static const unsigned int FormatArgsModeValues[] =
+{
+    OCI_FAM_LITERAL,
+    OCI_FAM_BIND
+};
+
 #define SET_TRACE(prop)                                                 \
                                                                         \
     con->trace->prop[0] = 0;                                            \
@@ -130,9 +139,11 @@ OCI_Connection * ConnectionAllocate
 
     /* set attributes */
 
-    con->mode     = mode;
-    con->pool     = pool;
-    con->sess_tag = NULL;
+    con->mode      = mode;
+    con->pool      = pool;
+    con->sess_tag  = NULL;
+    con->prep_size = OCI_DEFAUT_STMT_CACHE_SIZE;
+    con->fmt_mode  = OCI_FAM_LITERAL;
 
     if (NULL != con->pool)
     {
@@ -790,9 +801,7 @@ boolean ConnectionLogon
 
 #endif
 
-    /* get server version */
-
-    ConnectionGetServerVersion(con);
+    /* server version is retrieved on demand to avoid an extra round trip at logon */
 
     /* update internal status */
 
@@ -877,7 +886,11 @@ boolean ConnectionLogoffSessionPool
 
     /* No explicit transaction object => commit if needed otherwise rollback changes */
 
-    if (con->autocom)
+    if (con->sess_drop)
+    {
+        /* broken session, nothing to commit or rollback */
+    }
+    else if (con->autocom)
     {
         ConnectionCommit(con);
     }
@@ -901,6 +914,13 @@ boolean ConnectionLogoffSessionPool
             mode   = OCI_SESSRLS_RETAG;
         }
 
+        /* Remove broken session from the pool */
+
+        if (con->sess_drop)
+        {
+            mode |= OCI_SESSRLS_DROPSESS;
+        }
+
         CHECK_OCI
         (
             con->err,
@@ -940,6 +960,8 @@ boolean ConnectionLogOff
         /* context */ OCI_IPC_CONNECTION, con
     )
 
+    boolean lobs_freed = FALSE;
+
     CHECK_PTR(OCI_IPC_CONNECTION, con)
     CHECK_CON_STATUS(con, OCI_CONN_LOGGED)
 
@@ -954,6 +976,17 @@ boolean ConnectionLogOff
 
     ListForEachWithParam(Env.subs, con, (POCI_LIST_FOR_EACH_WITH_PARAM) ConnectionDetachSubscriptions);
 
+    /* free recycled temporary lobs while the session is still alive. The cache is
+       emptied even if some lobs cannot be freed, and the log off goes on anyway */
+
+    lobs_freed = LobShrinkCache(con, 0);
+
+    /* empty prepared statements cache (statements are freed below) */
+
+    FREE(con->prep_stmts)
+
+    con->prep_count = 0;
+
     /* free all statements */
 
     ListForEach(con->stmts, (POCI_LIST_FOR_EACH)StatementDispose);
@@ -1003,6 +1036,8 @@ boolean ConnectionLogOff
 
     con->cstate = OCI_CONN_ATTACHED;
 
+    CHECK(lobs_freed)
+
     SET_SUCCESS()
 
     EXIT_FUNC()
@@ -1050,6 +1085,8 @@ boolean ConnectionDispose
         FREE(con->formats[i])
     }
 
+    FREE(con->prep_stmts)
+    FREE(con->tmp_lobs)
     FREE(con->ver_str)
     FREE(con->sess_tag)
     FREE(con->db_name)
@@ -1123,6 +1160,176 @@ OCI_Connection * ConnectionCreateInternal
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionCreateBatchProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void ConnectionCreateBatchProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_ConnectionBatch *batch = (OCI_ConnectionBatch *) arg;
+
+    OCI_NOT_USED(thread)
+
+    for (;;)
+    {
+        unsigned int index = 0;
+
+        if (NULL != batch->mutex)
+        {
+            MutexAcquire(batch->mutex);
+        }
+
+        index = batch->next++;
+
+        if (NULL != batch->mutex)
+        {
+            MutexRelease(batch->mutex);
+        }
+
+        if (index >= batch->count)
+        {
+            break;
+        }
+
+        batch->cons[index] = ConnectionCreateInternal(NULL, batch->db, batch->user,
+                                                      batch->pwd, batch->mode, NULL);
+
+        if (NULL == batch->cons[index])
+        {
+            /* the error is reported through the slot error code and then cleared
+               in order to not be seen by the next connections of the batch */
+
+            OCI_Error *err = ErrorGet(FALSE, FALSE);
+
+            if (NULL != batch->codes)
+            {
+                batch->codes[index] = (NULL != err && 0 != err->code) ? err->code : -1;
+            }
+
+            ErrorReset(err);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionCreateMany
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionCreateMany
+(
+    const otext     *db,
+    const otext     *user,
+    const otext     *pwd,
+    unsigned int     mode,
+    OCI_Connection **cons,
+    int             *codes,
+    unsigned int     count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_ConnectionBatch batch;
+    OCI_Thread        **threads = NULL;
+
+    unsigned int nb_threads = 0;
+    unsigned int nb_started = 0;
+    unsigned int nb_created = 0;
+    unsigned int i          = 0;
+
+    memset(&batch, 0, sizeof(batch));
+
+    CHECK_INITIALIZED()
+    CHECK_XA_ENABLED(mode)
+    CHECK_PTR(OCI_IPC_CONNECTION_ARRAY, cons)
+
+    for (i = 0; i < count; i++)
+    {
+        cons[i] = NULL;
+
+        if (NULL != codes)
+        {
+            codes[i] = 0;
+        }
+    }
+
+    batch.db    = db;
+    batch.user  = user;
+    batch.pwd   = pwd;
+    batch.mode  = mode;
+    batch.cons  = cons;
+    batch.codes = codes;
+    batch.count = count;
+
+    if (LIB_THREADED && count > 1)
+    {
+        /* connections are handed to a bounded set of worker threads, each thread
+           creating connections until all of them have been processed */
+
+        nb_threads = count < OCI_CONNECTION_BATCH_THREADS ? count : OCI_CONNECTION_BATCH_THREADS;
+
+        batch.mutex = MutexCreateInternal();
+        CHECK_NULL(batch.mutex)
+
+        ALLOC_DATA(OCI_IPC_THREAD, threads, nb_threads)
+
+        for (nb_started = 0; nb_started < nb_threads; nb_started++)
+        {
+            threads[nb_started] = ThreadCreate();
+            CHECK_NULL(threads[nb_started])
+
+            if (!ThreadRun(threads[nb_started], ConnectionCreateBatchProc, &batch))
+            {
+                ThreadFree(threads[nb_started]);
+                threads[nb_started] = NULL;
+
+                CHECK(FALSE)
+            }
+        }
+    }
+    else
+    {
+        ConnectionCreateBatchProc(NULL, &batch);
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        /* threads already started still process the whole batch on failure */
+
+        for (i = 0; NULL != threads && i < nb_started; i++)
+        {
+            ThreadJoin(threads[i]);
+            ThreadFree(threads[i]);
+        }
+
+        FREE(threads)
+
+        if (NULL != batch.mutex)
+        {
+            MutexFree(batch.mutex);
+        }
+
+        for (i = 0; NULL != batch.cons && i < count; i++)
+        {
+            if (NULL != batch.cons[i])
+            {
+                nb_created++;
+            }
+        }
+
+        SET_RETVAL(nb_created)
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionGetMinSupportedVersion
  * --------------------------------------------------------------------------------------------- */
@@ -1140,7 +1347,9 @@ unsigned int ConnectionGetMinSupportedVersion
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
-    SET_RETVAL((Env.version_runtime > con->ver_num) ? con->ver_num : Env.version_runtime)
+    const unsigned int ver_num = ConnectionGetServerNumericVersion(con);
+
+    SET_RETVAL((Env.version_runtime > ver_num) ? ver_num : Env.version_runtime)
 
     EXIT_FUNC()
 }
@@ -1569,6 +1778,77 @@ unsigned int ConnectionGetSessionMode
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSharePoolMetadata
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ConnectionSharePoolMetadata
+(
+    OCI_Connection *con,
+    otext         **value,
+    otext         **shared
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* server metadata retrieved once by a pooled connection is kept by the
+       pool and then given to other connections from the same pool */
+
+    if (NULL != con->pool->mutex)
+    {
+        CHECK(MutexAcquire(con->pool->mutex))
+
+        locked = TRUE;
+    }
+
+    if (NULL == *value && NULL != *shared)
+    {
+        *value = ostrdup(*shared);
+
+        if (NULL == *value)
+        {
+            THROW(ExceptionMemory, OCI_IPC_STRING, (ostrlen(*shared) + 1) * sizeof(otext))
+        }
+
+        if (shared == &con->pool->ver_str)
+        {
+            con->ver_num = con->pool->ver_num;
+        }
+    }
+    else if (NULL != *value && NULL == *shared)
+    {
+        *shared = ostrdup(*value);
+
+        if (NULL == *shared)
+        {
+            THROW(ExceptionMemory, OCI_IPC_STRING, (ostrlen(*value) + 1) * sizeof(otext))
+        }
+
+        if (shared == &con->pool->ver_str)
+        {
+            con->pool->ver_num = con->ver_num;
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(con->pool->mutex);
+        }
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionGetVersionServer
  * --------------------------------------------------------------------------------------------- */
@@ -1589,6 +1869,13 @@ const otext * ConnectionGetServerVersion
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
+    /* pooled connections share the version retrieved by the first one */
+
+    if (!con->ver_str && NULL != con->pool)
+    {
+        CHECK(ConnectionSharePoolMetadata(con, &con->ver_str, &con->pool->ver_str))
+    }
+
     /* no version available in preliminary authentication mode */
 
     if (!con->ver_str && (!(con->mode & OCI_PRELIM_AUTH)))
@@ -1672,6 +1959,11 @@ const otext * ConnectionGetServerVersion
                 }
             }
         }
+
+        if (NULL != con->pool)
+        {
+            CHECK(ConnectionSharePoolMetadata(con, &con->ver_str, &con->pool->ver_str))
+        }
     }
 
     SET_RETVAL((const otext*)con->ver_str)
@@ -1687,6 +1979,35 @@ const otext * ConnectionGetServerVersion
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetServerNumericVersion
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetServerNumericVersion
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_UNKNOWN,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* no version available in preliminary authentication mode */
+
+    if (OCI_UNKNOWN == con->ver_num && !(con->mode & OCI_PRELIM_AUTH))
+    {
+        CHECK_NULL(ConnectionGetServerVersion(con))
+    }
+
+    SET_RETVAL(con->ver_num)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionGetServerMajorVersion
  * --------------------------------------------------------------------------------------------- */
@@ -1876,6 +2197,50 @@ boolean ConnectionBreak
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetNonBlockingMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetNonBlockingMode
+(
+    OCI_Connection *con,
+    boolean         value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    ub1 current = 0;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_SERVER, OCI_ATTR_NONBLOCKING_MODE,
+        con->svr, &current, NULL,
+        con->err
+    )
+
+    /* setting the attribute toggles the server handle mode */
+
+    if ((0 != current) != (FALSE != value))
+    {
+        CHECK_ATTRIB_SET
+        (
+            OCI_HTYPE_SERVER, OCI_ATTR_NONBLOCKING_MODE,
+            con->svr, NULL, 0,
+            con->err
+        )
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionServerEnableOutput
  * --------------------------------------------------------------------------------------------- */
@@ -1908,7 +2273,7 @@ boolean ConnectionEnableServerOutput
 
         /* check parameter ranges ( Oracle 10g increased the size of output line */
 
-        if (con->ver_num >= OCI_10_2 && lnsize > OCI_OUPUT_LSIZE_10G)
+        if (ConnectionGetServerNumericVersion(con) >= OCI_10_2 && lnsize > OCI_OUPUT_LSIZE_10G)
         {
             lnsize = OCI_OUPUT_LSIZE_10G;
         }
@@ -2443,12 +2808,22 @@ const otext * ConnectionGetDatabaseName
 
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
+    if (NULL == con->db_name && NULL != con->pool)
+    {
+        CHECK(ConnectionSharePoolMetadata(con, &con->db_name, &con->pool->db_name))
+    }
+
     if (NULL == con->db_name)
     {
         unsigned int size = 0;
 
         CHECK(StringGetAttribute(con, con->svr, OCI_HTYPE_SERVER,
                                  OCI_ATTR_DBNAME, &con->db_name, &size))
+
+        if (NULL != con->pool)
+        {
+            CHECK(ConnectionSharePoolMetadata(con, &con->db_name, &con->pool->db_name))
+        }
     }
 
 #endif
@@ -2509,12 +2884,22 @@ const otext * ConnectionGetServiceName
 
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
+    if (NULL == con->service_name && NULL != con->pool)
+    {
+        CHECK(ConnectionSharePoolMetadata(con, &con->service_name, &con->pool->service_name))
+    }
+
     if (NULL == con->service_name)
     {
         unsigned int size = 0;
 
         CHECK(StringGetAttribute(con, con->svr, OCI_HTYPE_SERVER,
                                  OCI_ATTR_SERVICENAME, &con->service_name, &size))
+
+        if (NULL != con->pool)
+        {
+            CHECK(ConnectionSharePoolMetadata(con, &con->service_name, &con->pool->service_name))
+        }
     }
 
 #endif
@@ -2576,12 +2961,22 @@ const otext * ConnectionGetDomainName
 
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
+    if (NULL == con->domain_name && NULL != con->pool)
+    {
+        CHECK(ConnectionSharePoolMetadata(con, &con->domain_name, &con->pool->domain_name))
+    }
+
     if (NULL == con->domain_name)
     {
         unsigned int size = 0;
 
         CHECK(StringGetAttribute(con, con->svr, OCI_HTYPE_SERVER,
                                  OCI_ATTR_DBDOMAIN, &con->domain_name, &size))
+
+        if (NULL != con->pool)
+        {
+            CHECK(ConnectionSharePoolMetadata(con, &con->domain_name, &con->pool->domain_name))
+        }
     }
 
 #endif
@@ -2802,6 +3197,246 @@ boolean ConnectionSetStatementCacheSize
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetPreparedCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetPreparedCacheSize
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ prep_size
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetPreparedCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* free least recently used statements that do not fit anymore */
+
+    while (con->prep_count > value)
+    {
+        OCI_Statement *stmt = con->prep_stmts[--con->prep_count];
+
+        con->prep_stmts[con->prep_count] = NULL;
+
+        stmt->released = FALSE;
+
+        CHECK(StatementFree(stmt))
+    }
+
+    /* resize statement array */
+
+    if (value > 0 && NULL != con->prep_stmts)
+    {
+        con->prep_stmts = MemoryRealloc(con->prep_stmts, OCI_IPC_STATEMENT_ARRAY,
+                                        sizeof(*con->prep_stmts), (size_t) value, TRUE);
+
+        CHECK_NULL(con->prep_stmts)
+    }
+    else if (0 == value)
+    {
+        FREE(con->prep_stmts)
+    }
+
+    con->prep_size = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetPreparedCacheHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetPreparedCacheHits
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ prep_hits
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetPreparedCacheMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetPreparedCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ prep_misses
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetTemporaryLobCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetTemporaryLobCacheSize
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ tmp_size
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetTemporaryLobCacheSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetTemporaryLobCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* free recycled lobs that do not fit anymore */
+
+    CHECK(LobShrinkCache(con, value))
+
+    /* resize lob array */
+
+    if (value > 0)
+    {
+        con->tmp_lobs = MemoryRealloc(con->tmp_lobs, OCI_IPC_ARRAY,
+                                      sizeof(*con->tmp_lobs), (size_t) value, TRUE);
+
+        CHECK_NULL(con->tmp_lobs)
+    }
+    else
+    {
+        FREE(con->tmp_lobs)
+    }
+
+    con->tmp_size = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetTemporaryLobCacheHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetTemporaryLobCacheHits
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ tmp_hits
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetTemporaryLobCacheMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetTemporaryLobCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ tmp_misses
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetFormatArgsMode
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetFormatArgsMode
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, OCI_UNKNOWN,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ fmt_mode
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetFormatArgsMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetFormatArgsMode
+(
+    OCI_Connection *con,
+    unsigned int    mode
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_ENUM_VALUE(mode, FormatArgsModeValues, OTEXT("Format arguments mode"))
+
+    con->fmt_mode = mode;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionGetDefaultLobPrefetchSize
  * --------------------------------------------------------------------------------------------- */
@@ -2992,13 +3627,10 @@ boolean ConnectionExecuteImmediateFmt
     )
 
     OCI_Statement *stmt = NULL;
-    otext* sql_fmt = NULL;
 
-    va_list first_pass_args;
-    va_list second_pass_args;
+    va_list fmt_args;
 
-    va_copy(first_pass_args,  args);
-    va_copy(second_pass_args, args);
+    va_copy(fmt_args, args);
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
     CHECK_PTR(OCI_IPC_STRING,     sql)
@@ -3008,44 +3640,27 @@ boolean ConnectionExecuteImmediateFmt
     stmt = StatementCreate(con);
     CHECK_NULL(stmt)
 
-    /* first, get buffer size */
-
-    int size = FormatParseSql(stmt, NULL, sql, &first_pass_args);
-    CHECK(size > 0)
+    /* format, prepare and execute SQL */
 
-    /* allocate buffer */
-
-    ALLOC_DATA(OCI_IPC_STRING, sql_fmt, size + 1)
-
-    /* format buffer */
-
-    size = FormatParseSql(stmt, sql_fmt, sql, &second_pass_args);
-    CHECK(size > 0)
-
-    /* prepare and execute SQL buffer */
-
-    CHECK(StatementPrepareInternal(stmt, sql_fmt))
+    CHECK(StatementPrepareFmtInternal(stmt, sql, &fmt_args))
     CHECK(StatementExecuteInternal(stmt, OCI_DEFAULT))
 
     /* get resultset and set up variables */
 
     if (OCI_CST_SELECT == StatementGetStatementType(stmt))
     {
-        CHECK(StatementFetchIntoUserVariables(stmt, second_pass_args))
+        CHECK(StatementFetchIntoUserVariables(stmt, fmt_args))
     }
 
     SET_SUCCESS()
 
     CLEANUP_AND_EXIT_FUNC
     (
-        va_end(first_pass_args);
-        va_end(second_pass_args);
+        va_end(fmt_args);
 
         if (NULL != stmt)
         {
             StatementFree(stmt);
         }
-
-        FREE(sql_fmt)
     )
 }
@@ -78,6 +78,17 @@ OCI_Connection* ConnectionCreate
     unsigned int mode
 );
 
+unsigned int ConnectionCreateMany
+(
+    const otext     *db,
+    const otext     *user,
+    const otext     *pwd,
+    unsigned int     mode,
+    OCI_Connection **cons,
+    int             *codes,
+    unsigned int     count
+);
+
 boolean ConnectionFree
 (
     OCI_Connection* con
@@ -162,6 +173,11 @@ const otext* ConnectionGetServerVersion
     OCI_Connection* con
 );
 
+unsigned int ConnectionGetServerNumericVersion
+(
+    OCI_Connection* con
+);
+
 unsigned int ConnectionGetServerMajorVersion
 (
     OCI_Connection* con
@@ -198,6 +214,12 @@ boolean ConnectionBreak
     OCI_Connection* con
 );
 
+boolean ConnectionSetNonBlockingMode
+(
+    OCI_Connection* con,
+    boolean         value
+);
+
 boolean ConnectionEnableServerOutput
 (
     OCI_Connection* con,
@@ -299,6 +321,59 @@ boolean ConnectionSetStatementCacheSize
     unsigned int    value
 );
 
+unsigned int ConnectionGetPreparedCacheSize
+(
+    OCI_Connection* con
+);
+
+boolean ConnectionSetPreparedCacheSize
+(
+    OCI_Connection* con,
+    unsigned int    value
+);
+
+unsigned int ConnectionGetPreparedCacheHits
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetPreparedCacheMisses
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetTemporaryLobCacheSize
+(
+    OCI_Connection* con
+);
+
+boolean ConnectionSetTemporaryLobCacheSize
+(
+    OCI_Connection* con,
+    unsigned int    value
+);
+
+unsigned int ConnectionGetTemporaryLobCacheHits
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetTemporaryLobCacheMisses
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetFormatArgsMode
+(
+    OCI_Connection* con
+);
+
+boolean ConnectionSetFormatArgsMode
+(
+    OCI_Connection* con,
+    unsigned int    mode
+);
+
 unsigned int ConnectionGetDefaultLobPrefetchSize
 (
     OCI_Connection* con
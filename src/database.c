@@ -62,6 +62,7 @@ boolean DatabaseStartup
 #endif
 
     CHECK_REMOTE_DBS_CONTROL_ENABLED()
+    CHECK_SYMBOLS(OCI_SYM_ADMIN)
 
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
@@ -194,6 +195,7 @@ boolean DatabaseShutdown
     OCI_Statement *stmt = NULL;
 
     CHECK_REMOTE_DBS_CONTROL_ENABLED()
+    CHECK_SYMBOLS(OCI_SYM_ADMIN)
 
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
@@ -187,31 +187,36 @@ typedef unsigned short dbtext;
 
 /* ---- Internal pointers ----- */
 
-#define OCI_IPC_LIST             41
-#define OCI_IPC_LIST_ITEM        42
-#define OCI_IPC_BIND_ARRAY       43
-#define OCI_IPC_DEFINE           44
-#define OCI_IPC_DEFINE_ARRAY     45
-#define OCI_IPC_HASHENTRY        46
-#define OCI_IPC_HASHENTRY_ARRAY  47
-#define OCI_IPC_HASHVALUE        48
-#define OCI_IPC_THREADKEY        49
-#define OCI_IPC_OCIDATE          50
-#define OCI_IPC_TM               51
-#define OCI_IPC_RESULTSET_ARRAY  52
-#define OCI_IPC_PLS_SIZE_ARRAY   53
-#define OCI_IPC_PLS_RCODE_ARRAY  54
-#define OCI_IPC_SERVER_OUPUT     55
-#define OCI_IPC_INDICATOR_ARRAY  56
-#define OCI_IPC_LEN_ARRAY        57
-#define OCI_IPC_BUFF_ARRAY       58
-#define OCI_IPC_LONG_BUFFER      59
-#define OCI_IPC_TRACE_INFO       60
-#define OCI_IPC_DP_COL_ARRAY     61
-#define OCI_IPC_BATCH_ERRORS     62
-#define OCI_IPC_STATEMENT_ARRAY  63
-
-#define OCI_IPC_COUNT            (OCI_IPC_STATEMENT_ARRAY + 2)
+#define OCI_IPC_LIST             43
+#define OCI_IPC_LIST_ITEM        44
+#define OCI_IPC_BIND_ARRAY       45
+#define OCI_IPC_DEFINE           46
+#define OCI_IPC_DEFINE_ARRAY     47
+#define OCI_IPC_HASHENTRY        48
+#define OCI_IPC_HASHENTRY_ARRAY  49
+#define OCI_IPC_HASHVALUE        50
+#define OCI_IPC_THREADKEY        51
+#define OCI_IPC_OCIDATE          52
+#define OCI_IPC_TM               53
+#define OCI_IPC_RESULTSET_ARRAY  54
+#define OCI_IPC_PLS_SIZE_ARRAY   55
+#define OCI_IPC_PLS_RCODE_ARRAY  56
+#define OCI_IPC_SERVER_OUPUT     57
+#define OCI_IPC_INDICATOR_ARRAY  58
+#define OCI_IPC_LEN_ARRAY        59
+#define OCI_IPC_BUFF_ARRAY       60
+#define OCI_IPC_LONG_BUFFER      61
+#define OCI_IPC_TRACE_INFO       62
+#define OCI_IPC_DP_COL_ARRAY     63
+#define OCI_IPC_BATCH_ERRORS     64
+#define OCI_IPC_STATEMENT_ARRAY  65
+#define OCI_IPC_FORMAT_TEMPLATE  66
+#define OCI_IPC_CONNECTION_ARRAY 67
+#define OCI_IPC_RWLOCK           68
+#define OCI_IPC_DP_WORKER_ARRAY  69
+#define OCI_IPC_ROUTER_ENTRY_ARRAY 70
+
+#define OCI_IPC_COUNT            (OCI_IPC_ROUTER_ENTRY_ARRAY + 2)
 
 /* --------------------------------------------------------------------------------------------- *
  * Oracle conditional features
@@ -227,8 +232,9 @@ typedef unsigned short dbtext;
 #define OCI_FEATURE_HIGH_AVAILABILITY    8
 #define OCI_FEATURE_XA                   9
 #define OCI_FEATURE_EXTENDED_PLSQLTYPES 10
+#define OCI_FEATURE_LOB_ARRAY_WRITE     11
 
-#define OCI_FEATURE_COUNT               OCI_FEATURE_EXTENDED_PLSQLTYPES
+#define OCI_FEATURE_COUNT               OCI_FEATURE_LOB_ARRAY_WRITE
 
 /* --------------------------------------------------------------------------------------------- *
  * handle types
@@ -306,6 +312,19 @@ typedef unsigned short dbtext;
 #define OCI_SFD_LAST                    0x08
 #define OCI_SFD_PREV                    0x10
 
+/* --------------------------------------------------------------------------------------------- *
+ * internal non blocking calls
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_ASYNC_CALL_NONE             0
+#define OCI_ASYNC_CALL_EXECUTE          1
+#define OCI_ASYNC_CALL_FETCH            2
+
+/* delays in milliseconds between polls of a pending non blocking call */
+
+#define OCI_ASYNC_WAIT_MIN_DELAY        1
+#define OCI_ASYNC_WAIT_MAX_DELAY        100
+
 /* --------------------------------------------------------------------------------------------- *
  * internal direct path column types
  * --------------------------------------------------------------------------------------------- */
@@ -322,6 +341,73 @@ typedef unsigned short dbtext;
 #define OCI_OUPUT_LSIZE                 255
 #define OCI_OUPUT_LSIZE_10G             32767
 
+/* --------------------------------------------------------------------------------------------- *
+ *  pool health keeper sleep step in milliseconds
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_POOL_KEEPER_SLEEP_STEP      100
+
+/* --------------------------------------------------------------------------------------------- *
+ *  pool thread bound connections array increment
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_POOL_THREAD_CONS_INC        8
+
+/* --------------------------------------------------------------------------------------------- *
+ *  pool router defaults
+ * --------------------------------------------------------------------------------------------- */
+
+/* delay in seconds a pool is skipped after a failure */
+
+#define OCI_POOL_ROUTER_BACKOFF         30
+
+/* latency in microseconds added to observed latencies, so that idle pools with
+   no recorded latency are still balanced on their load and weight */
+
+#define OCI_POOL_ROUTER_LATENCY_BASE    1000
+
+/* number of entries allocated at once */
+
+#define OCI_POOL_ROUTER_ENTRY_INC       4
+
+/* --------------------------------------------------------------------------------------------- *
+ *  maximum number of threads establishing connections concurrently
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_CONNECTION_BATCH_THREADS    32
+
+/* --------------------------------------------------------------------------------------------- *
+ *  maximum number of sessions of a direct path loader
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_DIRPATH_LOADER_WORKERS      32
+
+/* --------------------------------------------------------------------------------------------- *
+ *  parallel lob download read buffer and range sizes
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_LOB_DOWNLOAD_BUFFER_SIZE    (1024 * 1024)
+#define OCI_LOB_DOWNLOAD_SEGMENT_SIZE   (16 * 1024 * 1024)
+
+/* --------------------------------------------------------------------------------------------- *
+ *  maximum number of format templates kept by the environment
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_FMT_TEMPLATES_MAX           1024
+
+/* --------------------------------------------------------------------------------------------- *
+ *  direct path automatic stream sizing
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_DIRPATH_BUFFER_SIZE         (1024 * 1024)
+#define OCI_DIRPATH_AUTO_MAX_ROWS       (1024 * 1024)
+#define OCI_DIRPATH_COL_OVERHEAD        4
+
+/* largest column size whose buffer cells (characters in their client encoding and a
+   null terminator) fit in 32 bits */
+
+#define OCI_DIRPATH_MAX_COL_SIZE        (((ub4) -1) / (sizeof(otext) * OCI_UTF8_BYTES_PER_CHAR) - 1)
+
 /* --------------------------------------------------------------------------------------------- *
 *  Undocumented OCI SQL TYPES
 * --------------------------------------------------------------------------------------------- */
@@ -390,6 +476,21 @@ typedef unsigned short dbtext;
 
 #define OCI_VARS_WORKAROUND_UTF16_COLUMN_NAME  0
 
+/* groups of OCI symbols resolved together at runtime */
+
+#define OCI_SYM_CORE        0
+#define OCI_SYM_LOB         1
+#define OCI_SYM_TIMESTAMP   2
+#define OCI_SYM_INTERVAL    3
+#define OCI_SYM_COLLECTION  4
+#define OCI_SYM_POOL        5
+#define OCI_SYM_DIRPATH     6
+#define OCI_SYM_QUEUE       7
+#define OCI_SYM_NOTIFY      8
+#define OCI_SYM_ADMIN       9
+
+#define OCI_SYM_COUNT       10
+
 #ifndef min
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #endif
@@ -72,6 +72,8 @@ OCI_Dequeue * DequeueCreate
 
     /* allocate dequeue structure */
 
+    CHECK_SYMBOLS(OCI_SYM_QUEUE)
+
     ALLOC_DATA(OCI_IPC_DEQUEUE, dequeue, 1)
 
     dequeue->typinf = typinf;
@@ -901,6 +903,7 @@ boolean DequeueSubscribe
 
     CHECK_DATABASE_NOTIFY_ENABLED()
     CHECK_PTR(OCI_IPC_DEQUEUE, dequeue)
+    CHECK_SYMBOLS(OCI_SYM_NOTIFY)
 
     con = dequeue->typinf->con;
 
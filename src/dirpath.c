@@ -19,11 +19,23 @@
  */
 
 #include "dirpath.h"
+#include "dirpathscan.h"
 
 #include "macros.h"
 #include "memory.h"
 #include "number.h"
 #include "strings.h"
+#include "thread.h"
+
+#if defined(_WINDOWS)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <limits.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
 
 static const unsigned int ConversionModeValues[] =
 {
@@ -31,6 +43,21 @@ static const unsigned int ConversionModeValues[] =
     OCI_DCM_FORCE
 };
 
+/* memory mapping of a file loaded by DirPathLoadFile(), kept private
+   to this module to avoid spreading system headers */
+
+typedef struct OCI_DirPathFileMap
+{
+    const ub1 *data;    /* mapped file content */
+    size_t     size;    /* file size */
+#if defined(_WINDOWS)
+    HANDLE     file;    /* file handle */
+    HANDLE     handle;  /* file mapping handle */
+#else
+    int        fd;      /* file descriptor */
+#endif
+} OCI_DirPathFileMap;
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPathSetArray
  * --------------------------------------------------------------------------------------------- */
@@ -67,13 +94,25 @@ boolean DirPathSetArray
         {
             OCI_DirPathColumn *dpcol = &(dp->cols[col]);
 
-            /* get internal data cell */
+            /* get caller buffer set by reference or internal data cell */
+
+            if (NULL != dpcol->refs[row])
+            {
+                data = dpcol->refs[row];
+            }
+            else if (NULL != dpcol->data)
+            {
+                data = ((ub1 *) dpcol->data) + (size_t) row * dpcol->bufsize;
+            }
+            else
+            {
+                data = NULL;
+            }
 
-            data = ((ub1 *) dpcol->data) + (size_t) (row * dpcol->bufsize);
             size = dpcol->lens[row];
             flag = dpcol->flags[row];
 
-            if (SQLT_NUM == dpcol->sqlcode)
+            if (SQLT_NUM == dpcol->sqlcode && NULL != data)
             {
                 OCINumber *num = (OCINumber *) data;
 
@@ -208,12 +247,15 @@ unsigned int DirPathArrayToStream
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * DirPahArrayToStream
+ * DirPathGetLoadStatus
  * --------------------------------------------------------------------------------------------- */
 
-unsigned int DirPathLoadStream
+static unsigned int DirPathGetLoadStatus
 (
-    OCI_DirPath *dp
+    OCI_DirPath      *dp,
+    OCIDirPathStream *strm,
+    OCIError         *err,
+    sword             ret
 )
 {
     ENTER_FUNC
@@ -222,7 +264,6 @@ unsigned int DirPathLoadStream
         /* context */ OCI_IPC_DIRPATH, dp
     )
 
-    sword ret = OCI_SUCCESS;
     ub4 nb_loaded = 0;
     ub4 size      = sizeof(nb_loaded);
 
@@ -230,10 +271,6 @@ unsigned int DirPathLoadStream
 
     unsigned int status = OCI_DPR_ERROR;
 
-    /* load the stream */
-
-    ret = OCIDirPathLoadStream(dp->ctx, dp->strm, dp->con->err);
-
     switch (ret)
     {
         case OCI_SUCCESS:
@@ -245,7 +282,7 @@ unsigned int DirPathLoadStream
         case OCI_ERROR:
         {
             status = OCI_DPR_ERROR;
-            THROW(ExceptionOCI, dp->con->err, ret)
+            THROW(ExceptionOCI, err, ret)
             break;
         }
         case OCI_NO_DATA:
@@ -265,8 +302,8 @@ unsigned int DirPathLoadStream
     CHECK_ATTRIB_GET
     (
         OCI_HTYPE_DIRPATH_STREAM, OCI_ATTR_ROW_COUNT,
-        dp->strm, &nb_loaded, &size,
-        dp->con->err
+        strm, &nb_loaded, &size,
+        err
     )
 
     dp->nb_loaded    += nb_loaded;
@@ -286,6 +323,165 @@ unsigned int DirPathLoadStream
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoadStream
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoadStream
+(
+    OCI_DirPath      *dp,
+    OCIDirPathStream *strm,
+    OCIError         *err
+)
+{
+    return DirPathGetLoadStatus(dp, strm, err, OCIDirPathLoadStream(dp->ctx, strm, err));
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoadProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathLoadProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_DirPath *dp = (OCI_DirPath *) arg;
+
+    OCI_NOT_USED(thread)
+
+    /* only the OCI call is made here, its result being processed by the calling thread
+       in order to raise errors and to update the direct path status from that thread */
+
+    dp->pipe_ret = OCIDirPathLoadStream(dp->ctx, dp->pipe_strm, dp->pipe_err);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathStopLoad
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathStopLoad
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    /* wait for the worker thread, whatever the load outcome */
+
+    if (NULL != dp->pipe_thread)
+    {
+        OCI_Thread *thread = dp->pipe_thread;
+
+        dp->pipe_thread = NULL;
+
+        CHECK(ThreadJoin(thread))
+        CHECK(ThreadFree(thread))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathWaitLoad
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathWaitLoad
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    if (NULL != dp->pipe_thread)
+    {
+        CHECK(DirPathStopLoad(dp))
+
+        /* process the worker result as a synchronous load would do, including
+           loading again the stream until all non erred rows are loaded */
+
+        dp->res_load = DirPathGetLoadStatus(dp, dp->pipe_strm, dp->pipe_err, dp->pipe_ret);
+
+        while (OCI_DPR_ERROR == dp->res_load)
+        {
+            dp->res_load = DirPathLoadStream(dp, dp->pipe_strm, dp->pipe_err);
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathStartLoad
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathStartLoad
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    /* hand the converted stream over to the worker thread and convert
+       the next rows into the other stream, loaded at the previous call */
+
+    OCIDirPathStream *strm = dp->pipe_strm;
+
+    dp->pipe_strm = dp->strm;
+    dp->strm      = strm;
+
+    CHECK_OCI
+    (
+        dp->con->err,
+        OCIDirPathStreamReset,
+        dp->strm, dp->con->err
+    )
+
+    dp->pipe_thread = ThreadCreate();
+    CHECK_NULL(dp->pipe_thread)
+
+    CHECK(ThreadRun(dp->pipe_thread, DirPathLoadProc, dp))
+
+    dp->status = OCI_DPS_PREPARED;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            if (NULL != dp->pipe_thread)
+            {
+                ThreadFree(dp->pipe_thread);
+                dp->pipe_thread = NULL;
+            }
+
+            /* restore the converted stream as the current one */
+
+            strm          = dp->strm;
+            dp->strm      = dp->pipe_strm;
+            dp->pipe_strm = strm;
+        }
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPathCreate
  * --------------------------------------------------------------------------------------------- */
@@ -320,6 +516,8 @@ OCI_DirPath * DirPathCreate
 
     /* allocate direct path structure */
 
+    CHECK_SYMBOLS(OCI_SYM_DIRPATH)
+
     ALLOC_DATA(OCI_IPC_DIRPATH, dp, 1)
 
     dp->con      = typinf->con;
@@ -328,9 +526,9 @@ OCI_DirPath * DirPathCreate
     dp->res_conv = OCI_DPR_EMPTY;
     dp->res_load = OCI_DPR_EMPTY;
     dp->typinf   = typinf;
-    dp->nb_rows  = (ub2)nb_rows;
+    dp->nb_rows  = (ub4)nb_rows;
     dp->nb_cols  = (ub2)nb_cols;
-    dp->nb_cur   = (ub2)dp->nb_rows;
+    dp->nb_cur   = dp->nb_rows;
 
     /* allocates direct context handle */
 
@@ -383,7 +581,9 @@ OCI_DirPath * DirPathCreate
         )
     }
 
-    if (Env.version_runtime >= OCI_9_0)
+    /* when no number of rows is given, it is computed at prepare time from the columns size */
+
+    if (Env.version_runtime >= OCI_9_0 && dp->nb_rows > 0)
     {
         ub4 num_rows = dp->nb_rows;
 
@@ -445,9 +645,12 @@ boolean DirPathFree
 
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
 
+    DirPathStopLoad(dp);
+
     for (i = 0; i < dp->nb_cols; i++)
     {
         FREE(dp->cols[i].data)
+        FREE(dp->cols[i].refs)
         FREE(dp->cols[i].lens)
         FREE(dp->cols[i].flags)
         FREE(dp->cols[i].format)
@@ -458,6 +661,8 @@ boolean DirPathFree
     FREE(dp->err_rows)
 
     MemoryFreeHandle(dp->strm, OCI_HTYPE_DIRPATH_STREAM);
+    MemoryFreeHandle(dp->pipe_strm, OCI_HTYPE_DIRPATH_STREAM);
+    MemoryFreeHandle(dp->pipe_err, OCI_HTYPE_ERROR);
     MemoryFreeHandle(dp->arr,  OCI_HTYPE_DIRPATH_COLUMN_ARRAY);
     MemoryFreeHandle(dp->ctx,  OCI_HTYPE_DIRPATH_CTX);
 
@@ -505,6 +710,13 @@ boolean DirPathSetColumn
     CHECK_PTR(OCI_IPC_STRING, name)
     CHECK_BOUND(index, 1, dp->nb_cols)
 
+    /* the column buffer size is computed from maxsize and must not wrap around */
+
+    if (maxsize > OCI_DIRPATH_MAX_COL_SIZE)
+    {
+        THROW(ExceptionArgInvalidValue, OTEXT("maxsize"), maxsize)
+    }
+
     /* check if column exists */
 
     for (i = 0; i < dp->typinf->nb_cols; i++)
@@ -529,8 +741,8 @@ boolean DirPathSetColumn
 
     /* default column attributes */
 
-    dpcol->maxsize     = (ub2) maxsize;
-    dpcol->bufsize     = (ub2) maxsize + 1;
+    dpcol->maxsize     = (ub4) maxsize;
+    dpcol->bufsize     = (ub4) maxsize + 1;
     dpcol->sqlcode     = SQLT_CHR;
     dpcol->type        = OCI_DDT_TEXT;
     dpcol->index       = i;
@@ -576,7 +788,7 @@ boolean DirPathSetColumn
             {
                 dpcol->format      = ostrdup(format);
                 dpcol->format_size = (ub4) ostrlen(format);
-                dpcol->maxsize     = (ub2) max(dpcol->format_size, maxsize);
+                dpcol->maxsize     = (ub4) max(dpcol->format_size, maxsize);
                 dpcol->bufsize    *= sizeof(otext);
             }
             break;
@@ -748,6 +960,38 @@ boolean DirPathPrepare
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_NOT_PREPARED)
 
+    /* automatic sizing : the number of rows is computed in order to fill
+       the stream transfer buffer with rows of the maximum columns size */
+
+    if (0 == dp->nb_rows)
+    {
+        ub4 row_size = 0;
+
+        if (0 == dp->buf_size)
+        {
+            CHECK(DirPathSetBufferSize(dp, OCI_DIRPATH_BUFFER_SIZE))
+        }
+
+        for (ub2 i = 0; i < dp->nb_cols; i++)
+        {
+            row_size += dp->cols[i].maxsize + OCI_DIRPATH_COL_OVERHEAD;
+        }
+
+        num_rows = dp->buf_size / max(row_size, 1);
+        num_rows = max(num_rows, 1);
+        num_rows = min(num_rows, OCI_DIRPATH_AUTO_MAX_ROWS);
+
+        if (Env.version_runtime >= OCI_9_0)
+        {
+            CHECK_ATTRIB_SET
+            (
+                OCI_HTYPE_DIRPATH_CTX, OCI_ATTR_NUM_ROWS,
+                dp->ctx, &num_rows, sizeof(num_rows),
+                dp->typinf->con->err
+            )
+        }
+    }
+
     /* prepare direct path operation */
 
     CHECK_OCI
@@ -782,6 +1026,23 @@ boolean DirPathPrepare
         )
     )
 
+    /* allocate the second stream and the worker error handle in pipelined mode */
+
+    if (dp->pipelined)
+    {
+        CHECK
+        (
+            MemoryAllocHandle
+            (
+                (dvoid *)dp->ctx,
+                (dvoid **)(void *)&dp->pipe_strm,
+                OCI_HTYPE_DIRPATH_STREAM
+            )
+        )
+
+        CHECK(MemoryAllocHandle(Env.env, (dvoid **)(void *)&dp->pipe_err, OCI_HTYPE_ERROR))
+    }
+
     /* check the number of rows allocated */
 
     CHECK_ATTRIB_GET
@@ -791,8 +1052,8 @@ boolean DirPathPrepare
         dp->typinf->con->err
     )
 
-    dp->nb_cur  = (ub2) num_rows;
-    dp->nb_rows = (ub2) num_rows;
+    dp->nb_cur  = num_rows;
+    dp->nb_rows = num_rows;
 
     /* allocate array of errs rows */
 
@@ -802,13 +1063,14 @@ boolean DirPathPrepare
 
     ALLOC_DATA(OCI_IPC_BUFF_ARRAY, dp->err_cols, dp->nb_cur)
 
-    /* now, we need to allocate internal buffers */
+    /* now, we need to allocate internal buffers.
+       Data cells are only allocated when a column entry is set by value */
 
     for (ub2 i = 0; i < dp->nb_cols; i++)
     {
         OCI_DirPathColumn *col = &dp->cols[i];
 
-        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->data,  col->bufsize, dp->nb_cur)
+        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->refs,  sizeof(ub1*), dp->nb_cur)
         ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->lens,  sizeof(ub4),  dp->nb_cur)
         ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->flags, sizeof(ub1),  dp->nb_cur)
     }
@@ -821,17 +1083,17 @@ boolean DirPathPrepare
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * DirPathSetEntry
+ * DirPathSetCell
  * --------------------------------------------------------------------------------------------- */
 
-boolean DirPathSetEntry
+static boolean DirPathSetCell
 (
-    OCI_DirPath *dp,
-    unsigned int row,
-    unsigned int index,
-    void        *value,
-    unsigned int size,
-    boolean      complete
+    OCI_DirPath       *dp,
+    OCI_DirPathColumn *dpcol,
+    ub4                row,
+    void              *value,
+    unsigned int       size,
+    boolean            complete
 )
 {
     ENTER_FUNC
@@ -840,18 +1102,8 @@ boolean DirPathSetEntry
         /* context */ OCI_IPC_DIRPATH, dp
     )
 
-    OCI_DirPathColumn *dpcol = NULL;
-
     ub1 flag = 0;
 
-    CHECK_PTR(OCI_IPC_DIRPATH, dp)
-    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
-    CHECK_BOUND(index, 1, dp->nb_cols)
-    CHECK_BOUND(row,   1, dp->nb_cur)
-
-    dpcol = &dp->cols[index-1];
-    CHECK_NULL(dpcol)
-
     /* check size */
 
     if (size > dpcol->maxsize)
@@ -888,7 +1140,7 @@ boolean DirPathSetEntry
 
         /* get internal data cell */
 
-        ub1 *data = ((ub1 *) dpcol->data) + (size_t) ((row-1) * dpcol->bufsize);
+        ub1 *data = ((ub1 *) dpcol->data) + (size_t) row * dpcol->bufsize;
 
         /* we weed to pack the buffer if wchar_t is 4 bytes */
 
@@ -923,8 +1175,9 @@ boolean DirPathSetEntry
         }
     }
 
-    dpcol->lens[row-1]  = size;
-    dpcol->flags[row-1] = flag;
+    dpcol->refs[row]  = NULL;
+    dpcol->lens[row]  = size;
+    dpcol->flags[row] = flag;
 
     SET_SUCCESS()
 
@@ -932,12 +1185,13 @@ boolean DirPathSetEntry
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * DirPathReset
+ * DirPathAllocateCells
  * --------------------------------------------------------------------------------------------- */
 
-boolean DirPathReset
+static boolean DirPathAllocateCells
 (
-    OCI_DirPath *dp
+    OCI_DirPath       *dp,
+    OCI_DirPathColumn *dpcol
 )
 {
     ENTER_FUNC
@@ -946,33 +1200,54 @@ boolean DirPathReset
         /* context */ OCI_IPC_DIRPATH, dp
     )
 
-    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    /* internal data cells are allocated at first entry set by value */
 
-    /* reset conversion and loading variables */
+    if (NULL == dpcol->data)
+    {
+        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, dpcol->data, dpcol->bufsize, dp->nb_rows)
+    }
 
-    dp->nb_processed = 0;
-    dp->nb_converted = 0;
-    dp->nb_err       = 0;
-    dp->idx_err_row  = 0;
-    dp->idx_err_col  = 0;
+    SET_SUCCESS()
 
-    /* reset array */
+    EXIT_FUNC()
+}
 
-    CHECK_OCI
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetEntry
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetEntry
+(
+    OCI_DirPath *dp,
+    unsigned int row,
+    unsigned int index,
+    void        *value,
+    unsigned int size,
+    boolean      complete
+)
+{
+    ENTER_FUNC
     (
-        dp->typinf->con->err,
-        OCIDirPathColArrayReset,
-        dp->arr, dp->con->err
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
     )
 
-    /* reset stream */
+    OCI_DirPathColumn *dpcol = NULL;
 
-    CHECK_OCI
-    (
-        dp->typinf->con->err,
-        OCIDirPathStreamReset,
-        dp->strm, dp->con->err
-    )
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+    CHECK_BOUND(index, 1, dp->nb_cols)
+    CHECK_BOUND(row,   1, dp->nb_cur)
+
+    dpcol = &dp->cols[index-1];
+    CHECK_NULL(dpcol)
+
+    if (NULL != value)
+    {
+        CHECK(DirPathAllocateCells(dp, dpcol))
+    }
+
+    CHECK(DirPathSetCell(dp, dpcol, row - 1, value, size, complete))
 
     SET_SUCCESS()
 
@@ -980,28 +1255,209 @@ boolean DirPathReset
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * DirPathConvert
+ * DirPathSetEntries
  * --------------------------------------------------------------------------------------------- */
 
-unsigned int DirPathConvert
+boolean DirPathSetEntries
 (
-    OCI_DirPath *dp
+    OCI_DirPath  *dp,
+    unsigned int  row,
+    unsigned int  index,
+    unsigned int  count,
+    void         *values,
+    unsigned int  stride,
+    unsigned int *sizes,
+    boolean      *nulls
 )
 {
     ENTER_FUNC
     (
-        /* returns */ unsigned int, OCI_DPR_ERROR,
+        /* returns */ boolean, FALSE,
         /* context */ OCI_IPC_DIRPATH, dp
     )
 
-    ub4 row_from = 0;
+    OCI_DirPathColumn *dpcol = NULL;
 
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_PTR(OCI_IPC_VOID, values)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+    CHECK_BOUND(index, 1, dp->nb_cols)
+    CHECK_BOUND(row,   1, dp->nb_cur)
+    CHECK_BOUND(count, 1, dp->nb_cur - row + 1)
+    CHECK_MIN(stride, 1)
 
-    /* reset the number of processed rows */
+    dpcol = &dp->cols[index-1];
+    CHECK_NULL(dpcol)
 
-    dp->nb_processed = 0;
+    CHECK(DirPathAllocateCells(dp, dpcol))
+
+    /* all checks are done once for the whole range, then values are set cell by cell */
+
+    for (ub4 i = 0; i < count; i++)
+    {
+        ub1 *value = ((ub1 *) values) + (size_t) i * stride;
+        unsigned int size = 0;
+
+        if (NULL != nulls && nulls[i])
+        {
+            value = NULL;
+        }
+        else if (NULL != sizes)
+        {
+            size = sizes[i];
+        }
+        else if (OCI_DDT_BINARY == dpcol->type)
+        {
+            size = stride;
+        }
+        else
+        {
+            size = (unsigned int) ostrlen((otext *) value);
+        }
+
+        CHECK(DirPathSetCell(dp, dpcol, row - 1 + i, value, size, TRUE))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetEntryByRef
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetEntryByRef
+(
+    OCI_DirPath *dp,
+    unsigned int row,
+    unsigned int index,
+    const void  *value,
+    unsigned int size,
+    boolean      complete
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    OCI_DirPathColumn *dpcol = NULL;
+
+    ub1 flag = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+    CHECK_BOUND(index, 1, dp->nb_cols)
+    CHECK_BOUND(row,   1, dp->nb_cur)
+
+    dpcol = &dp->cols[index-1];
+    CHECK_NULL(dpcol)
+
+    /* numeric columns with a format need a conversion into an internal OCINumber */
+
+    CHECK_COMPAT(OCI_DDT_NUMBER != dpcol->type)
+
+    /* setup column flag */
+
+    if (!value)
+    {
+        flag = OCI_DIRPATH_COL_NULL;
+        size = 0;
+    }
+    else if (complete)
+    {
+        flag = OCI_DIRPATH_COL_COMPLETE;
+    }
+    else
+    {
+        flag = OCI_DIRPATH_COL_PARTIAL;
+    }
+
+    /* the caller buffer is given as is to OCI when converting the array,
+       so it must remain valid until the row is converted */
+
+    dpcol->refs[row-1]  = (ub1 *) value;
+    dpcol->lens[row-1]  = size;
+    dpcol->flags[row-1] = flag;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathReset
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathReset
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+
+    /* reset conversion and loading variables */
+
+    dp->nb_processed = 0;
+    dp->nb_converted = 0;
+    dp->nb_err       = 0;
+    dp->idx_err_row  = 0;
+    dp->idx_err_col  = 0;
+
+    /* reset array */
+
+    CHECK_OCI
+    (
+        dp->typinf->con->err,
+        OCIDirPathColArrayReset,
+        dp->arr, dp->con->err
+    )
+
+    /* reset stream */
+
+    CHECK_OCI
+    (
+        dp->typinf->con->err,
+        OCIDirPathStreamReset,
+        dp->strm, dp->con->err
+    )
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathConvert
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathConvert
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_DPR_ERROR,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    ub4 row_from = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+
+    /* reset the number of processed rows */
+
+    dp->nb_processed = 0;
 
     /* in case of previous error in default mode or if the stream is full,
        let's start again from the last faulted row */
@@ -1094,15 +1550,26 @@ unsigned int DirPathLoad
     dp->idx_err_row = 0;
     dp->res_load    = OCI_DPR_COMPLETE;
 
-    /* load the stream */
+    if (dp->pipelined)
+    {
+        /* wait for the stream submitted at the previous call, then load
+           the current one in background while next rows are converted */
+
+        CHECK(DirPathWaitLoad(dp))
+        CHECK(DirPathStartLoad(dp))
+    }
+    else
+    {
+        /* load the stream */
 
-    dp->res_load = DirPathLoadStream(dp);
+        dp->res_load = DirPathLoadStream(dp, dp->strm, dp->con->err);
 
-    /* continue to load the stream while it returns an error */
+        /* continue to load the stream while it returns an error */
 
-    while (OCI_DPR_ERROR == dp->res_load)
-    {
-        dp->res_load = DirPathLoadStream(dp);
+        while (OCI_DPR_ERROR == dp->res_load)
+        {
+            dp->res_load = DirPathLoadStream(dp, dp->strm, dp->con->err);
+        }
     }
 
     SET_RETVAL(dp->res_load)
@@ -1110,6 +1577,535 @@ unsigned int DirPathLoad
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathMapFile
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathMapFile
+(
+    OCI_DirPath        *dp,
+    OCI_DirPathFileMap *map,
+    const otext        *filename
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    boolean res = FALSE;
+
+#if defined(_WINDOWS)
+
+    LARGE_INTEGER size;
+
+  #if defined(OCI_CHARSET_WIDE)
+    map->file = CreateFileW(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  #else
+    map->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  #endif
+
+    if (INVALID_HANDLE_VALUE != map->file && GetFileSizeEx(map->file, &size) &&
+        (ULONGLONG) size.QuadPart <= (ULONGLONG) ((size_t) -1))
+    {
+        map->size = (size_t) size.QuadPart;
+
+        /* empty files cannot be mapped and have nothing to load */
+
+        res = (0 == map->size);
+
+        if (!res)
+        {
+            map->handle = CreateFileMapping(map->file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+            if (NULL != map->handle)
+            {
+                map->data = (const ub1 *) MapViewOfFile(map->handle, FILE_MAP_READ, 0, 0, 0);
+                res       = (NULL != map->data);
+            }
+        }
+    }
+
+#else
+
+    struct stat st;
+
+  #if defined(OCI_CHARSET_WIDE)
+
+    char *name = NULL;
+    size_t len = ostrlen(filename) * MB_LEN_MAX + 1;
+
+    ALLOC_DATA(OCI_IPC_STRING, name, len)
+
+    if ((size_t) -1 != wcstombs(name, filename, len))
+    {
+        map->fd = open(name, O_RDONLY);
+    }
+
+    FREE(name)
+
+  #else
+
+    map->fd = open(filename, O_RDONLY);
+
+  #endif
+
+    if (map->fd >= 0 && 0 == fstat(map->fd, &st) && (big_uint) st.st_size <= (big_uint) ((size_t) -1))
+    {
+        map->size = (size_t) st.st_size;
+
+        /* empty files cannot be mapped and have nothing to load */
+
+        res = (0 == map->size);
+
+        if (!res)
+        {
+            void *data = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, map->fd, 0);
+
+            if (MAP_FAILED != data)
+            {
+                map->data = (const ub1 *) data;
+                res       = TRUE;
+
+            #if defined(MADV_SEQUENTIAL)
+
+                /* the file is read once from its beginning to its end */
+
+                madvise(data, map->size, MADV_SEQUENTIAL);
+
+            #endif
+            }
+        }
+    }
+
+#endif
+
+    if (!res)
+    {
+        THROW(ExceptionFileAccess, filename)
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathUnmapFile
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathUnmapFile
+(
+    OCI_DirPathFileMap *map
+)
+{
+#if defined(_WINDOWS)
+
+    if (NULL != map->data)
+    {
+        UnmapViewOfFile(map->data);
+    }
+
+    if (NULL != map->handle)
+    {
+        CloseHandle(map->handle);
+    }
+
+    if (INVALID_HANDLE_VALUE != map->file)
+    {
+        CloseHandle(map->file);
+    }
+
+#else
+
+    if (NULL != map->data)
+    {
+        munmap((void *) map->data, map->size);
+    }
+
+    if (map->fd >= 0)
+    {
+        close(map->fd);
+    }
+
+#endif
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetFileCell
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathSetFileCell
+(
+    OCI_DirPath       *dp,
+    OCI_DirPathColumn *dpcol,
+    ub4                row,
+    const ub1         *value,
+    size_t             size,
+    boolean            escaped,
+    ub1                quote,
+    otext             *buffer,
+    boolean           *rejected
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    size_t i = 0;
+    size_t n = 0;
+
+    if (0 == size)
+    {
+        /* empty fields are loaded as null values */
+
+        dpcol->refs[row]  = NULL;
+        dpcol->lens[row]  = 0;
+        dpcol->flags[row] = OCI_DIRPATH_COL_NULL;
+    }
+    else if (!escaped && OCI_DDT_NUMBER != dpcol->type &&
+             (OCI_DDT_TEXT != dpcol->type || OCI_CHAR_WIDE != Env.charset))
+    {
+        /* the field is given as is to OCI from the file mapping, unless it is
+           longer than the column maximum size */
+
+        if (size > dpcol->maxsize)
+        {
+            *rejected = TRUE;
+        }
+        else
+        {
+            dpcol->refs[row]  = (ub1 *) value;
+            dpcol->lens[row]  = (ub4) size;
+            dpcol->flags[row] = OCI_DIRPATH_COL_COMPLETE;
+        }
+    }
+    else
+    {
+        /* the field needs to be unescaped, widened or converted to a number,
+           thus it is copied into the internal data cell */
+
+        CHECK(DirPathAllocateCells(dp, dpcol))
+
+        for (i = 0; i < size && n < dpcol->maxsize; i++, n++)
+        {
+            /* doubled quotes stand for a single one */
+
+            if (escaped && quote == value[i] && ++i >= size)
+            {
+                break;
+            }
+
+            if (OCI_DDT_BINARY == dpcol->type)
+            {
+                ((ub1 *) buffer)[n] = value[i];
+            }
+            else
+            {
+                buffer[n] = (otext) value[i];
+            }
+        }
+
+        /* fields longer than the column maximum size reject their row instead of
+           being truncated */
+
+        if (i < size)
+        {
+            *rejected = TRUE;
+        }
+
+        if (OCI_DDT_BINARY != dpcol->type)
+        {
+            buffer[n] = 0;
+        }
+
+        CHECK(DirPathSetCell(dp, dpcol, row, buffer, (unsigned int) n, TRUE))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoadRows
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathLoadRows
+(
+    OCI_DirPath *dp,
+    ub4          nb_rows
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    unsigned int res = OCI_DPR_ERROR;
+
+    dp->nb_cur = nb_rows;
+
+    /* convert the rows and load the stream each time it is full, the
+       conversion being resumed from the first row that did not fit */
+
+    do
+    {
+        res = DirPathConvert(dp);
+
+        if (OCI_DPR_COMPLETE == res || OCI_DPR_FULL == res)
+        {
+            CHECK(OCI_DPR_ERROR != DirPathLoad(dp))
+        }
+    }
+    while (OCI_DPR_FULL == res);
+
+    /* in force mode, a conversion error means that all remaining rows have been rejected */
+
+    CHECK(OCI_DPR_ERROR != res || OCI_DCM_FORCE == dp->cvt_mode)
+
+    CHECK(DirPathReset(dp))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoadFile
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoadFile
+(
+    OCI_DirPath *dp,
+    const otext *filename,
+    otext        delimiter,
+    otext        quote,
+    unsigned int skip_lines
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    OCI_DirPathFileMap map;
+
+    otext *buffer = NULL;
+
+    const ub1 *ptr = NULL;
+    const ub1 *end = NULL;
+
+    ub4 nb_cur  = 0;
+    ub4 row     = 0;
+    ub4 line    = 0;
+    ub4 maxsize = 0;
+    ub2 col     = 0;
+    ub1 dlm     = (ub1) delimiter;
+    ub1 qt      = (ub1) quote;
+
+    boolean rejected = FALSE;
+
+    memset(&map, 0, sizeof(map));
+
+#if defined(_WINDOWS)
+    map.file = INVALID_HANDLE_VALUE;
+#else
+    map.fd = -1;
+#endif
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_PTR(OCI_IPC_STRING, filename)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+
+    /* the file is scanned as single byte characters */
+
+    CHECK_COMPAT((otext) dlm == delimiter && (otext) qt == quote)
+    CHECK_COMPAT(0 != dlm && dlm != qt && '\n' != dlm && '\r' != dlm && '\n' != qt && '\r' != qt)
+
+    nb_cur = dp->nb_cur;
+
+    /* fields that cannot be given by reference are copied in a single buffer
+       large enough for the biggest column */
+
+    for (col = 0; col < dp->nb_cols; col++)
+    {
+        if (dp->cols[col].maxsize > maxsize)
+        {
+            maxsize = dp->cols[col].maxsize;
+        }
+    }
+
+    ALLOC_DATA(OCI_IPC_STRING, buffer, (size_t) maxsize + 1)
+
+    CHECK(DirPathMapFile(dp, &map, filename))
+
+    ptr = map.data;
+    end = map.data + map.size;
+
+    /* skip UTF8 byte order mark */
+
+    if (map.size >= 3 && 0xEF == ptr[0] && 0xBB == ptr[1] && 0xBF == ptr[2])
+    {
+        ptr += 3;
+    }
+
+    CHECK(DirPathReset(dp))
+
+    while (ptr < end)
+    {
+        /* skip empty lines */
+
+        if ('\n' == *ptr || '\r' == *ptr)
+        {
+            ptr++;
+            continue;
+        }
+
+        col      = 0;
+        rejected = FALSE;
+
+        /* parse the fields of the current record */
+
+        for (;;)
+        {
+            const ub1 *value   = ptr;
+            const ub1 *last    = NULL;
+            boolean    escaped = FALSE;
+
+            if (0 != qt && qt == *ptr)
+            {
+                /* quoted field ending at the next quote not doubled */
+
+                value = ++ptr;
+
+                for (;;)
+                {
+                    ptr = (const ub1 *) memchr(ptr, qt, (size_t) (end - ptr));
+
+                    if (NULL == ptr)
+                    {
+                        ptr = end;
+                        break;
+                    }
+
+                    if (ptr + 1 < end && qt == ptr[1])
+                    {
+                        escaped = TRUE;
+                        ptr    += 2;
+                        continue;
+                    }
+
+                    break;
+                }
+
+                last = ptr;
+
+                /* ignore characters between the closing quote and the delimiter */
+
+                ptr = DirPathScanField(ptr, end, dlm);
+            }
+            else
+            {
+                ptr  = DirPathScanField(ptr, end, dlm);
+                last = ptr;
+            }
+
+            /* fields beyond the number of columns to load are ignored */
+
+            if (line >= skip_lines && col < dp->nb_cols)
+            {
+                CHECK(DirPathSetFileCell(dp, &dp->cols[col], row, value, (size_t) (last - value),
+                                         escaped, qt, buffer, &rejected))
+            }
+
+            col++;
+
+            if (ptr < end && dlm == *ptr)
+            {
+                ptr++;
+                continue;
+            }
+
+            break;
+        }
+
+        /* skip end of line */
+
+        if (ptr < end && '\r' == *ptr)
+        {
+            ptr++;
+        }
+
+        if (ptr < end && '\n' == *ptr)
+        {
+            ptr++;
+        }
+
+        if (line++ < skip_lines)
+        {
+            continue;
+        }
+
+        /* in force mode, a rejected record is discarded and its row is reused
+           by the next one, otherwise the load fails */
+
+        if (rejected)
+        {
+            if (OCI_DCM_FORCE != dp->cvt_mode)
+            {
+                THROW(ExceptionArgInvalidValue, OTEXT("line"), line)
+            }
+
+            continue;
+        }
+
+        /* missing fields are loaded as null values */
+
+        for (; col < dp->nb_cols; col++)
+        {
+            dp->cols[col].refs[row]  = NULL;
+            dp->cols[col].lens[row]  = 0;
+            dp->cols[col].flags[row] = OCI_DIRPATH_COL_NULL;
+        }
+
+        /* convert and load rows once the array is full */
+
+        if (++row == dp->nb_rows)
+        {
+            CHECK(DirPathLoadRows(dp, row))
+
+            row = 0;
+        }
+    }
+
+    if (row > 0)
+    {
+        CHECK(DirPathLoadRows(dp, row))
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        DirPathUnmapFile(&map);
+
+        if (0 != nb_cur)
+        {
+            dp->nb_cur = nb_cur;
+        }
+
+        FREE(buffer)
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPathFinish
  * --------------------------------------------------------------------------------------------- */
@@ -1128,6 +2124,10 @@ boolean DirPathFinish
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    /* in pipelined mode, the last stream may still be loading */
+
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1160,6 +2160,8 @@ boolean DirPathAbort
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    CHECK(DirPathStopLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1192,6 +2194,8 @@ boolean DirPathSave
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1223,6 +2227,8 @@ boolean DirPathFlushRow
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1255,7 +2261,7 @@ boolean DirPathSetCurrentRows
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
     CHECK_BOUND(nb_rows, 1, dp->nb_rows)
 
-    dp->nb_cur = (ub2) nb_rows;
+    dp->nb_cur = (ub4) nb_rows;
 
     SET_SUCCESS()
 
@@ -1368,6 +2374,37 @@ boolean DirPathSetParallel
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetPipelined
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetPipelined
+(
+    OCI_DirPath *dp,
+    boolean      value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_NOT_PREPARED)
+
+    if (value)
+    {
+        CHECK_THREAD_ENABLED()
+    }
+
+    dp->pipelined = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPathSetNoLog
  * --------------------------------------------------------------------------------------------- */
@@ -1479,6 +2516,8 @@ boolean DirPathSetBufferSize
         dp->typinf->con->err
     )
 
+    dp->buf_size = bufsize;
+
     SET_SUCCESS()
 
     EXIT_FUNC()
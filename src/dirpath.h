@@ -60,6 +60,28 @@ boolean DirPathSetEntry
     boolean      complete
 );
 
+boolean DirPathSetEntries
+(
+    OCI_DirPath  *dp,
+    unsigned int  row,
+    unsigned int  index,
+    unsigned int  count,
+    void         *values,
+    unsigned int  stride,
+    unsigned int *sizes,
+    boolean      *nulls
+);
+
+boolean DirPathSetEntryByRef
+(
+    OCI_DirPath *dp,
+    unsigned int row,
+    unsigned int index,
+    const void  *value,
+    unsigned int size,
+    boolean      complete
+);
+
 boolean DirPathReset
 (
     OCI_DirPath *dp
@@ -75,6 +97,15 @@ unsigned int DirPathLoad
     OCI_DirPath *dp
 );
 
+boolean DirPathLoadFile
+(
+    OCI_DirPath *dp,
+    const otext *filename,
+    otext        delimiter,
+    otext        quote,
+    unsigned int skip_lines
+);
+
 boolean DirPathFinish
 (
     OCI_DirPath *dp
@@ -123,6 +154,12 @@ boolean DirPathSetParallel
     boolean      value
 );
 
+boolean DirPathSetPipelined
+(
+    OCI_DirPath *dp,
+    boolean      value
+);
+
 boolean DirPathSetNoLog
 (
     OCI_DirPath *dp,
@@ -0,0 +1,710 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dirpathloader.h"
+
+#include "connection.h"
+#include "dirpath.h"
+#include "error.h"
+#include "list.h"
+#include "macros.h"
+#include "memory.h"
+#include "thread.h"
+#include "typeinfo.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderWorkerProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathLoaderWorkerProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_DirPathWorker *worker = (OCI_DirPathWorker *) arg;
+    OCI_DirPath       *dp     = worker->dp;
+    OCI_Error         *err    = ErrorGet(FALSE, FALSE);
+
+    unsigned int res = OCI_DPR_ERROR;
+
+    OCI_NOT_USED(thread)
+
+    ErrorReset(err);
+
+    /* convert the batch and load the stream each time it is full, the conversion
+       being resumed from the first row that did not fit into the stream */
+
+    do
+    {
+        res = DirPathConvert(dp);
+
+        if (OCI_DPR_COMPLETE == res || OCI_DPR_FULL == res)
+        {
+            /* rows skipped by the conversion in force mode */
+
+            worker->nb_rejected += dp->nb_err;
+
+            if (OCI_DPR_ERROR == DirPathLoad(dp))
+            {
+                res = OCI_DPR_ERROR;
+            }
+
+            /* rows rejected by the server */
+
+            worker->nb_rejected += dp->nb_err;
+        }
+    }
+    while (OCI_DPR_FULL == res);
+
+    /* errors are reported to the caller through the loader and then cleared
+       in order to not be seen by the next batches processed by this thread */
+
+    if (OCI_DPR_ERROR == res || (NULL != err && 0 != err->code))
+    {
+        worker->failed = TRUE;
+        worker->code   = (NULL != err && 0 != err->code) ? err->code : -1;
+    }
+
+    ErrorReset(err);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderWait
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathLoaderWait
+(
+    OCI_DirPathLoader *dpl,
+    OCI_DirPathWorker *worker
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    /* wait for the batch submitted to the worker and collect its outcome */
+
+    if (NULL != worker->thread)
+    {
+        OCI_Thread *thread = worker->thread;
+
+        worker->thread = NULL;
+
+        CHECK(ThreadJoin(thread))
+        CHECK(ThreadFree(thread))
+
+        worker->nb_loaded = worker->dp->nb_loaded;
+
+        dpl->nb_rejected += worker->nb_rejected;
+
+        if (worker->failed)
+        {
+            dpl->nb_failed++;
+            dpl->code = worker->code;
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderWaitAll
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathLoaderWaitAll
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    boolean res = TRUE;
+
+    unsigned int i = 0;
+
+    /* all workers are waited for, even if one of them fails */
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        res = DirPathLoaderWait(dpl, &dpl->workers[i]) && res;
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_DirPathLoader * DirPathLoaderCreate
+(
+    OCI_TypeInfo *typinf,
+    const otext  *partition,
+    unsigned int  nb_cols,
+    unsigned int  nb_rows,
+    unsigned int  nb_workers
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_DirPathLoader*, NULL,
+        /* context */ OCI_IPC_TYPE_INFO, typinf
+    )
+
+    OCI_DirPathLoader *dpl  = NULL;
+    OCI_Connection   **cons = NULL;
+
+    otext name[OCI_SIZE_OBJ_NAME * 2 + 2];
+
+    unsigned int nb_created = 0;
+    unsigned int i          = 0;
+
+    CHECK_PTR(OCI_IPC_TYPE_INFO, typinf)
+    CHECK_COMPAT(typinf->type != OCI_TIF_TYPE)
+    CHECK_BOUND(nb_cols, 1, typinf->nb_cols)
+    CHECK_BOUND(nb_workers, 1, OCI_DIRPATH_LOADER_WORKERS)
+    CHECK_THREAD_ENABLED()
+
+    dpl = ListAppend(Env.dpls, sizeof(*dpl));
+    CHECK_NULL(dpl)
+
+    dpl->typinf     = typinf;
+    dpl->status     = OCI_DPS_NOT_PREPARED;
+    dpl->nb_workers = nb_workers;
+
+    ALLOC_DATA(OCI_IPC_DP_WORKER_ARRAY, dpl->workers, nb_workers)
+    ALLOC_DATA(OCI_IPC_CONNECTION_ARRAY, cons, nb_workers)
+
+    /* worker sessions are established concurrently using the credentials
+       of the session the table has been described from */
+
+    nb_created = ConnectionCreateMany(typinf->con->db, typinf->con->user, typinf->con->pwd,
+                                      typinf->con->mode, cons, NULL, nb_workers);
+
+    for (i = 0; i < nb_workers; i++)
+    {
+        dpl->workers[i].con = cons[i];
+    }
+
+    /* sessions that could not be established are tried again from the calling
+       thread in order to report the error to the caller */
+
+    for (i = 0; i < nb_workers && nb_created < nb_workers; i++)
+    {
+        if (NULL == dpl->workers[i].con)
+        {
+            dpl->workers[i].con = ConnectionCreateInternal(NULL, typinf->con->db, typinf->con->user,
+                                                           typinf->con->pwd, typinf->con->mode, NULL);
+            CHECK_NULL(dpl->workers[i].con)
+
+            nb_created++;
+        }
+    }
+
+    /* describe the table again from each worker session */
+
+    name[0] = 0;
+
+    if (IS_STRING_VALID(typinf->schema))
+    {
+        ostrncat(name, typinf->schema, (size_t) OCI_SIZE_OBJ_NAME);
+        ostrncat(name, OTEXT("."), (size_t) OCI_SIZE_OBJ_NAME);
+    }
+
+    ostrncat(name, typinf->name, (size_t) OCI_SIZE_OBJ_NAME);
+
+    for (i = 0; i < nb_workers; i++)
+    {
+        OCI_DirPathWorker *worker = &dpl->workers[i];
+
+        OCI_TypeInfo *worker_typinf = TypeInfoGet(worker->con, name, typinf->type);
+        CHECK_NULL(worker_typinf)
+
+        worker->dp = DirPathCreate(worker_typinf, partition, nb_cols, nb_rows);
+        CHECK_NULL(worker->dp)
+
+        /* sessions loading the same table concurrently must use parallel loads */
+
+        CHECK(DirPathSetParallel(worker->dp, TRUE))
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(cons)
+
+        if (FAILURE)
+        {
+            DirPathLoaderFree(dpl);
+            dpl = NULL;
+        }
+
+        SET_RETVAL(dpl)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderDispose
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderDispose
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+
+    /* running workers are joined before their sessions are closed */
+
+    for (i = 0; NULL != dpl->workers && i < dpl->nb_workers; i++)
+    {
+        OCI_DirPathWorker *worker = &dpl->workers[i];
+
+        DirPathLoaderWait(dpl, worker);
+
+        if (NULL != worker->dp)
+        {
+            DirPathFree(worker->dp);
+        }
+
+        if (NULL != worker->con)
+        {
+            ConnectionFree(worker->con);
+        }
+    }
+
+    FREE(dpl->workers)
+
+    dpl->nb_workers = 0;
+
+    ErrorResetSource(NULL, dpl);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderFree
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+
+    DirPathLoaderDispose(dpl);
+    ListRemove(Env.dpls, dpl);
+
+    FREE(dpl)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderSetColumn
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderSetColumn
+(
+    OCI_DirPathLoader *dpl,
+    unsigned int       index,
+    const otext       *name,
+    unsigned int       maxsize,
+    const otext       *format
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_NOT_PREPARED)
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        CHECK(DirPathSetColumn(dpl->workers[i].dp, index, name, maxsize, format))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderSetConvertMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderSetConvertMode
+(
+    OCI_DirPathLoader *dpl,
+    unsigned int       mode
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_NOT_PREPARED)
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        CHECK(DirPathSetConvertMode(dpl->workers[i].dp, mode))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderPrepare
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderPrepare
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_NOT_PREPARED)
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        CHECK(DirPathPrepare(dpl->workers[i].dp))
+    }
+
+    dpl->status = OCI_DPS_PREPARED;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetBatch
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_DirPath * DirPathLoaderGetBatch
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_DirPath*, NULL,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    OCI_DirPathWorker *worker = NULL;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_PREPARED)
+
+    /* batches are handed out by the workers in turn, a worker still
+       processing its previous batch being waited for */
+
+    worker = &dpl->workers[dpl->next];
+
+    CHECK(DirPathLoaderWait(dpl, worker))
+    CHECK(DirPathReset(worker->dp))
+
+    worker->acquired = TRUE;
+
+    dpl->next = (dpl->next + 1) % dpl->nb_workers;
+
+    SET_RETVAL(worker->dp)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderSubmit
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderSubmit
+(
+    OCI_DirPathLoader *dpl,
+    OCI_DirPath       *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    OCI_DirPathWorker *worker = NULL;
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_PREPARED)
+
+    for (i = 0; i < dpl->nb_workers && NULL == worker; i++)
+    {
+        if (dpl->workers[i].dp == dp && dpl->workers[i].acquired)
+        {
+            worker = &dpl->workers[i];
+        }
+    }
+
+    /* only batches handed out by DirPathLoaderGetBatch() can be submitted */
+
+    CHECK_COMPAT(NULL != worker)
+
+    worker->acquired    = FALSE;
+    worker->nb_rejected = 0;
+    worker->failed      = FALSE;
+    worker->code        = 0;
+
+    worker->thread = ThreadCreate();
+    CHECK_NULL(worker->thread)
+
+    CHECK(ThreadRun(worker->thread, DirPathLoaderWorkerProc, worker))
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE && NULL != worker && NULL != worker->thread)
+        {
+            ThreadFree(worker->thread);
+            worker->thread = NULL;
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderFinish
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderFinish
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_PREPARED)
+
+    CHECK(DirPathLoaderWaitAll(dpl))
+
+    /* rows of batches handed out but not submitted are discarded */
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        dpl->workers[i].acquired = FALSE;
+
+        CHECK(DirPathFinish(dpl->workers[i].dp))
+    }
+
+    dpl->status = OCI_DPS_TERMINATED;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderAbort
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderAbort
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+    CHECK_DIRPATH_STATUS(dpl, OCI_DPS_PREPARED)
+
+    CHECK(DirPathLoaderWaitAll(dpl))
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        OCI_DirPathWorker *worker = &dpl->workers[i];
+
+        worker->acquired = FALSE;
+
+        if (OCI_DPS_PREPARED == worker->dp->status)
+        {
+            CHECK(DirPathAbort(worker->dp))
+        }
+    }
+
+    dpl->status = OCI_DPS_TERMINATED;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetWorkerCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetWorkerCount
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_DIRPATH_LOADER, dpl,
+        /* member */ nb_workers
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetRowCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetRowCount
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_DIRPATH_LOADER, dpl
+    )
+
+    unsigned int count = 0;
+    unsigned int i     = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, dpl)
+
+    /* only batches that have been waited for are accounted */
+
+    for (i = 0; i < dpl->nb_workers; i++)
+    {
+        count += dpl->workers[i].nb_loaded;
+    }
+
+    SET_RETVAL(count)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetRejectedCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetRejectedCount
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_DIRPATH_LOADER, dpl,
+        /* member */ nb_rejected
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetErrorCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetErrorCount
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_DIRPATH_LOADER, dpl,
+        /* member */ nb_failed
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetErrorCode
+ * --------------------------------------------------------------------------------------------- */
+
+int DirPathLoaderGetErrorCode
+(
+    OCI_DirPathLoader *dpl
+)
+{
+    GET_PROP
+    (
+        /* result */ int, 0,
+        /* handle */ OCI_IPC_DIRPATH_LOADER, dpl,
+        /* member */ code
+    )
+}
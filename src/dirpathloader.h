@@ -0,0 +1,112 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef OCILIB_DIRPATHLOADER_H_INCLUDED
+#define OCILIB_DIRPATHLOADER_H_INCLUDED
+
+#include "types.h"
+
+OCI_DirPathLoader * DirPathLoaderCreate
+(
+    OCI_TypeInfo *typinf,
+    const otext  *partition,
+    unsigned int  nb_cols,
+    unsigned int  nb_rows,
+    unsigned int  nb_workers
+);
+
+boolean DirPathLoaderDispose
+(
+    OCI_DirPathLoader *dpl
+);
+
+boolean DirPathLoaderFree
+(
+    OCI_DirPathLoader *dpl
+);
+
+boolean DirPathLoaderSetColumn
+(
+    OCI_DirPathLoader *dpl,
+    unsigned int       index,
+    const otext       *name,
+    unsigned int       maxsize,
+    const otext       *format
+);
+
+boolean DirPathLoaderSetConvertMode
+(
+    OCI_DirPathLoader *dpl,
+    unsigned int       mode
+);
+
+boolean DirPathLoaderPrepare
+(
+    OCI_DirPathLoader *dpl
+);
+
+OCI_DirPath * DirPathLoaderGetBatch
+(
+    OCI_DirPathLoader *dpl
+);
+
+boolean DirPathLoaderSubmit
+(
+    OCI_DirPathLoader *dpl,
+    OCI_DirPath       *dp
+);
+
+boolean DirPathLoaderFinish
+(
+    OCI_DirPathLoader *dpl
+);
+
+boolean DirPathLoaderAbort
+(
+    OCI_DirPathLoader *dpl
+);
+
+unsigned int DirPathLoaderGetWorkerCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+unsigned int DirPathLoaderGetRowCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+unsigned int DirPathLoaderGetRejectedCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+unsigned int DirPathLoaderGetErrorCount
+(
+    OCI_DirPathLoader *dpl
+);
+
+int DirPathLoaderGetErrorCode
+(
+    OCI_DirPathLoader *dpl
+);
+
+#endif /* OCILIB_DIRPATHLOADER_H_INCLUDED */
@@ -0,0 +1,83 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_DIRPATHSCAN_H_INCLUDED
+#define OCILIB_DIRPATHSCAN_H_INCLUDED
+
+/* the field scanner has no dependency on OCI types, so that the test suite
+   can include it without linking to the library internals */
+
+#include <stddef.h>
+#include <string.h>
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathScanField
+ * --------------------------------------------------------------------------------------------- */
+
+static const unsigned char * DirPathScanField
+(
+    const unsigned char *ptr,
+    const unsigned char *end,
+    unsigned char        delimiter
+)
+{
+    /* unquoted fields end at the next delimiter or end of line. Instead of testing
+       each byte, the input is tested a machine word at a time : a word contains one
+       of the searched bytes if the word XORed with that byte repeated contains a null
+       byte, which is detected for all bytes of the word at once */
+
+    const size_t ones  = ((size_t) -1) / 0xFF;
+    const size_t highs = ones * 0x80;
+    const size_t delim = ones * delimiter;
+    const size_t lf    = ones * '\n';
+    const size_t cr    = ones * '\r';
+
+    while ((size_t) (end - ptr) >= sizeof(size_t))
+    {
+        size_t word = 0;
+        size_t v1   = 0;
+        size_t v2   = 0;
+        size_t v3   = 0;
+
+        memcpy(&word, ptr, sizeof(word));
+
+        v1 = word ^ delim;
+        v2 = word ^ lf;
+        v3 = word ^ cr;
+
+        if (((v1 - ones) & ~v1 & highs) | ((v2 - ones) & ~v2 & highs) | ((v3 - ones) & ~v3 & highs))
+        {
+            break;
+        }
+
+        ptr += sizeof(size_t);
+    }
+
+    /* locate the byte within the word and process the remaining bytes */
+
+    while (ptr < end && delimiter != *ptr && '\n' != *ptr && '\r' != *ptr)
+    {
+        ptr++;
+    }
+
+    return ptr;
+}
+
+#endif /* OCILIB_DIRPATHSCAN_H_INCLUDED */
@@ -59,6 +59,8 @@ OCI_Enqueue * EnqueueCreate
 
     /* allocate enqueue structure */
 
+    CHECK_SYMBOLS(OCI_SYM_QUEUE)
+
     ALLOC_DATA(OCI_IPC_ENQUEUE, enqueue, 1)
 
     enqueue->typinf = typinf;
@@ -23,12 +23,17 @@
 #include "array.h"
 #include "callback.h"
 #include "connection.h"
+#include "dirpathloader.h"
 #include "error.h"
+#include "format.h"
 #include "hash.h"
+#include "helpers.h"
 #include "list.h"
 #include "macros.h"
 #include "mutex.h"
+#include "rwlock.h"
 #include "pool.h"
+#include "poolrouter.h"
 #include "subscription.h"
 #include "threadkey.h"
 
@@ -530,11 +535,335 @@ OCILOBREAD2         OCILobRead2         = NULL;
 OCILOBTRIM2         OCILobTrim2         = NULL;
 OCILOBWRITE2        OCILobWrite2        = NULL;
 OCILOBWRITEAPPEND2  OCILobWriteAppend2  = NULL;
+OCILOBARRAYWRITE    OCILobArrayWrite    = NULL;
 
   #endif /* ORAXB8_DEFINED */
 
+/* OCI symbols table
+   Symbols used to guess the runtime OCI version belong to the core group */
+
+static const OCI_Symbol EnvironmentSymbols[] =
+{
+    { "OCIEnvCreate",                 (POCI_SYMBOL *) &OCIEnvCreate,                 OCI_SYM_CORE },
+
+    { "OCIServerAttach",              (POCI_SYMBOL *) &OCIServerAttach,              OCI_SYM_CORE },
+    { "OCIServerDetach",              (POCI_SYMBOL *) &OCIServerDetach,              OCI_SYM_CORE },
+
+    { "OCIHandleAlloc",               (POCI_SYMBOL *) &OCIHandleAlloc,               OCI_SYM_CORE },
+    { "OCIHandleFree",                (POCI_SYMBOL *) &OCIHandleFree,                OCI_SYM_CORE },
+
+    { "OCIDescriptorAlloc",           (POCI_SYMBOL *) &OCIDescriptorAlloc,           OCI_SYM_CORE },
+    { "OCIDescriptorFree",            (POCI_SYMBOL *) &OCIDescriptorFree,            OCI_SYM_CORE },
+
+    { "OCIAttrSet",                   (POCI_SYMBOL *) &OCIAttrSet,                   OCI_SYM_CORE },
+    { "OCIAttrGet",                   (POCI_SYMBOL *) &OCIAttrGet,                   OCI_SYM_CORE },
+
+    { "OCIParamSet",                  (POCI_SYMBOL *) &OCIParamSet,                  OCI_SYM_CORE },
+    { "OCIParamGet",                  (POCI_SYMBOL *) &OCIParamGet,                  OCI_SYM_CORE },
+
+    { "OCISessionBegin",              (POCI_SYMBOL *) &OCISessionBegin,              OCI_SYM_CORE },
+    { "OCISessionEnd",                (POCI_SYMBOL *) &OCISessionEnd,                OCI_SYM_CORE },
+
+    { "OCIPasswordChange",            (POCI_SYMBOL *) &OCIPasswordChange,            OCI_SYM_CORE },
+
+    { "OCITransStart",                (POCI_SYMBOL *) &OCITransStart,                OCI_SYM_CORE },
+    { "OCITransDetach",               (POCI_SYMBOL *) &OCITransDetach,               OCI_SYM_CORE },
+    { "OCITransPrepare",              (POCI_SYMBOL *) &OCITransPrepare,              OCI_SYM_CORE },
+    { "OCITransForget",               (POCI_SYMBOL *) &OCITransForget,               OCI_SYM_CORE },
+    { "OCITransCommit",               (POCI_SYMBOL *) &OCITransCommit,               OCI_SYM_CORE },
+    { "OCITransRollback",             (POCI_SYMBOL *) &OCITransRollback,             OCI_SYM_CORE },
+
+    { "OCIErrorGet",                  (POCI_SYMBOL *) &OCIErrorGet,                  OCI_SYM_CORE },
+    { "OCIServerVersion",             (POCI_SYMBOL *) &OCIServerVersion,             OCI_SYM_CORE },
+    { "OCIBreak",                     (POCI_SYMBOL *) &OCIBreak,                     OCI_SYM_CORE },
+
+    { "OCIBindByPos",                 (POCI_SYMBOL *) &OCIBindByPos,                 OCI_SYM_CORE },
+    { "OCIBindByName",                (POCI_SYMBOL *) &OCIBindByName,                OCI_SYM_CORE },
+    { "OCIBindDynamic",               (POCI_SYMBOL *) &OCIBindDynamic,               OCI_SYM_CORE },
+    { "OCIBindObject",                (POCI_SYMBOL *) &OCIBindObject,                OCI_SYM_CORE },
+
+    { "OCIDefineByPos",               (POCI_SYMBOL *) &OCIDefineByPos,               OCI_SYM_CORE },
+    { "OCIDefineObject",              (POCI_SYMBOL *) &OCIDefineObject,              OCI_SYM_CORE },
+
+    { "OCIStmtPrepare",               (POCI_SYMBOL *) &OCIStmtPrepare,               OCI_SYM_CORE },
+    { "OCIStmtExecute",               (POCI_SYMBOL *) &OCIStmtExecute,               OCI_SYM_CORE },
+    { "OCIStmtFetch",                 (POCI_SYMBOL *) &OCIStmtFetch,                 OCI_SYM_CORE },
+    { "OCIStmtFetch2",                (POCI_SYMBOL *) &OCIStmtFetch2,                OCI_SYM_CORE },
+
+    { "OCIStmtGetPieceInfo",          (POCI_SYMBOL *) &OCIStmtGetPieceInfo,          OCI_SYM_CORE },
+    { "OCIStmtSetPieceInfo",          (POCI_SYMBOL *) &OCIStmtSetPieceInfo,          OCI_SYM_CORE },
+
+    { "OCILobCreateTemporary",        (POCI_SYMBOL *) &OCILobCreateTemporary,        OCI_SYM_LOB },
+    { "OCILobFreeTemporary",          (POCI_SYMBOL *) &OCILobFreeTemporary,          OCI_SYM_LOB },
+    { "OCILobIsTemporary",            (POCI_SYMBOL *) &OCILobIsTemporary,            OCI_SYM_LOB },
+    { "OCILobRead",                   (POCI_SYMBOL *) &OCILobRead,                   OCI_SYM_LOB },
+    { "OCILobWrite",                  (POCI_SYMBOL *) &OCILobWrite,                  OCI_SYM_LOB },
+    { "OCILobCopy",                   (POCI_SYMBOL *) &OCILobCopy,                   OCI_SYM_LOB },
+    { "OCILobTrim",                   (POCI_SYMBOL *) &OCILobTrim,                   OCI_SYM_LOB },
+    { "OCILobErase",                  (POCI_SYMBOL *) &OCILobErase,                  OCI_SYM_LOB },
+    { "OCILobAppend",                 (POCI_SYMBOL *) &OCILobAppend,                 OCI_SYM_LOB },
+    { "OCILobGetLength",              (POCI_SYMBOL *) &OCILobGetLength,              OCI_SYM_LOB },
+    { "OCILobGetChunkSize",           (POCI_SYMBOL *) &OCILobGetChunkSize,           OCI_SYM_LOB },
+    { "OCILobOpen",                   (POCI_SYMBOL *) &OCILobOpen,                   OCI_SYM_LOB },
+    { "OCILobClose",                  (POCI_SYMBOL *) &OCILobClose,                  OCI_SYM_LOB },
+
+  #ifdef ORAXB8_DEFINED
+
+    { "OCILobCopy2",                  (POCI_SYMBOL *) &OCILobCopy2,                  OCI_SYM_CORE },
+    { "OCILobErase2",                 (POCI_SYMBOL *) &OCILobErase2,                 OCI_SYM_LOB },
+    { "OCILobGetLength2",             (POCI_SYMBOL *) &OCILobGetLength2,             OCI_SYM_LOB },
+    { "OCILobLoadFromFile2",          (POCI_SYMBOL *) &OCILobLoadFromFile2,          OCI_SYM_LOB },
+    { "OCILobRead2",                  (POCI_SYMBOL *) &OCILobRead2,                  OCI_SYM_LOB },
+    { "OCILobTrim2",                  (POCI_SYMBOL *) &OCILobTrim2,                  OCI_SYM_LOB },
+    { "OCILobWrite2",                 (POCI_SYMBOL *) &OCILobWrite2,                 OCI_SYM_CORE },
+    { "OCILobWriteAppend2",           (POCI_SYMBOL *) &OCILobWriteAppend2,           OCI_SYM_LOB },
+    { "OCILobArrayWrite",             (POCI_SYMBOL *) &OCILobArrayWrite,             OCI_SYM_LOB },
+
+  #endif /* ORAXB8_DEFINED */
+
+    { "OCILobFileOpen",               (POCI_SYMBOL *) &OCILobFileOpen,               OCI_SYM_LOB },
+    { "OCILobFileClose",              (POCI_SYMBOL *) &OCILobFileClose,              OCI_SYM_LOB },
+    { "OCILobFileCloseAll",           (POCI_SYMBOL *) &OCILobFileCloseAll,           OCI_SYM_LOB },
+    { "OCILobFileIsOpen",             (POCI_SYMBOL *) &OCILobFileIsOpen,             OCI_SYM_LOB },
+    { "OCILobFileExists",             (POCI_SYMBOL *) &OCILobFileExists,             OCI_SYM_LOB },
+    { "OCILobFileGetName",            (POCI_SYMBOL *) &OCILobFileGetName,            OCI_SYM_LOB },
+    { "OCILobFileSetName",            (POCI_SYMBOL *) &OCILobFileSetName,            OCI_SYM_LOB },
+    { "OCILobLoadFromFile",           (POCI_SYMBOL *) &OCILobLoadFromFile,           OCI_SYM_LOB },
+    { "OCILobWriteAppend",            (POCI_SYMBOL *) &OCILobWriteAppend,            OCI_SYM_LOB },
+    { "OCILobIsEqual",                (POCI_SYMBOL *) &OCILobIsEqual,                OCI_SYM_LOB },
+    { "OCILobAssign",                 (POCI_SYMBOL *) &OCILobAssign,                 OCI_SYM_LOB },
+    { "OCILobLocatorAssign",          (POCI_SYMBOL *) &OCILobLocatorAssign,          OCI_SYM_LOB },
+    { "OCILobFlushBuffer",            (POCI_SYMBOL *) &OCILobFlushBuffer,            OCI_SYM_LOB },
+    { "OCILobGetStorageLimit",        (POCI_SYMBOL *) &OCILobGetStorageLimit,        OCI_SYM_LOB },
+    { "OCILobEnableBuffering",        (POCI_SYMBOL *) &OCILobEnableBuffering,        OCI_SYM_LOB },
+    { "OCILobDisableBuffering",       (POCI_SYMBOL *) &OCILobDisableBuffering,       OCI_SYM_LOB },
+
+    { "OCIDateAssign",                (POCI_SYMBOL *) &OCIDateAssign,                OCI_SYM_CORE },
+    { "OCIDateToText",                (POCI_SYMBOL *) &OCIDateToText,                OCI_SYM_CORE },
+    { "OCIDateFromText",              (POCI_SYMBOL *) &OCIDateFromText,              OCI_SYM_CORE },
+    { "OCIDateCompare",               (POCI_SYMBOL *) &OCIDateCompare,               OCI_SYM_CORE },
+    { "OCIDateAddMonths",             (POCI_SYMBOL *) &OCIDateAddMonths,             OCI_SYM_CORE },
+    { "OCIDateAddDays",               (POCI_SYMBOL *) &OCIDateAddDays,               OCI_SYM_CORE },
+    { "OCIDateLastDay",               (POCI_SYMBOL *) &OCIDateLastDay,               OCI_SYM_CORE },
+    { "OCIDateDaysBetween",           (POCI_SYMBOL *) &OCIDateDaysBetween,           OCI_SYM_CORE },
+    { "OCIDateZoneToZone",            (POCI_SYMBOL *) &OCIDateZoneToZone,            OCI_SYM_CORE },
+    { "OCIDateNextDay",               (POCI_SYMBOL *) &OCIDateNextDay,               OCI_SYM_CORE },
+    { "OCIDateCheck",                 (POCI_SYMBOL *) &OCIDateCheck,                 OCI_SYM_CORE },
+    { "OCIDateSysDate",               (POCI_SYMBOL *) &OCIDateSysDate,               OCI_SYM_CORE },
+    { "OCIDescribeAny",               (POCI_SYMBOL *) &OCIDescribeAny,               OCI_SYM_CORE },
+
+    { "OCIIntervalAssign",            (POCI_SYMBOL *) &OCIIntervalAssign,            OCI_SYM_INTERVAL },
+    { "OCIIntervalCheck",             (POCI_SYMBOL *) &OCIIntervalCheck,             OCI_SYM_INTERVAL },
+    { "OCIIntervalCompare",           (POCI_SYMBOL *) &OCIIntervalCompare,           OCI_SYM_INTERVAL },
+    { "OCIIntervalFromText",          (POCI_SYMBOL *) &OCIIntervalFromText,          OCI_SYM_INTERVAL },
+    { "OCIIntervalToText",            (POCI_SYMBOL *) &OCIIntervalToText,            OCI_SYM_INTERVAL },
+    { "OCIIntervalFromTZ",            (POCI_SYMBOL *) &OCIIntervalFromTZ,            OCI_SYM_INTERVAL },
+    { "OCIIntervalGetDaySecond",      (POCI_SYMBOL *) &OCIIntervalGetDaySecond,      OCI_SYM_INTERVAL },
+    { "OCIIntervalGetYearMonth",      (POCI_SYMBOL *) &OCIIntervalGetYearMonth,      OCI_SYM_INTERVAL },
+    { "OCIIntervalSetDaySecond",      (POCI_SYMBOL *) &OCIIntervalSetDaySecond,      OCI_SYM_INTERVAL },
+    { "OCIIntervalSetYearMonth",      (POCI_SYMBOL *) &OCIIntervalSetYearMonth,      OCI_SYM_INTERVAL },
+    { "OCIIntervalSubtract",          (POCI_SYMBOL *) &OCIIntervalSubtract,          OCI_SYM_INTERVAL },
+    { "OCIIntervalAdd",               (POCI_SYMBOL *) &OCIIntervalAdd,               OCI_SYM_INTERVAL },
+
+    { "OCIDateTimeAssign",            (POCI_SYMBOL *) &OCIDateTimeAssign,            OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeCheck",             (POCI_SYMBOL *) &OCIDateTimeCheck,             OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeCompare",           (POCI_SYMBOL *) &OCIDateTimeCompare,           OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeConstruct",         (POCI_SYMBOL *) &OCIDateTimeConstruct,         OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeConvert",           (POCI_SYMBOL *) &OCIDateTimeConvert,           OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeFromArray",         (POCI_SYMBOL *) &OCIDateTimeFromArray,         OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeToArray",           (POCI_SYMBOL *) &OCIDateTimeToArray,           OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeFromText",          (POCI_SYMBOL *) &OCIDateTimeFromText,          OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeToText",            (POCI_SYMBOL *) &OCIDateTimeToText,            OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeGetDate",           (POCI_SYMBOL *) &OCIDateTimeGetDate,           OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeGetTime",           (POCI_SYMBOL *) &OCIDateTimeGetTime,           OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeGetTimeZoneName",   (POCI_SYMBOL *) &OCIDateTimeGetTimeZoneName,   OCI_SYM_CORE },
+    { "OCIDateTimeGetTimeZoneOffset", (POCI_SYMBOL *) &OCIDateTimeGetTimeZoneOffset, OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeIntervalAdd",       (POCI_SYMBOL *) &OCIDateTimeIntervalAdd,       OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeIntervalSub",       (POCI_SYMBOL *) &OCIDateTimeIntervalSub,       OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeSubtract",          (POCI_SYMBOL *) &OCIDateTimeSubtract,          OCI_SYM_TIMESTAMP },
+    { "OCIDateTimeSysTimeStamp",      (POCI_SYMBOL *) &OCIDateTimeSysTimeStamp,      OCI_SYM_TIMESTAMP },
+
+    { "OCITypeByRef",                 (POCI_SYMBOL *) &OCITypeByRef,                 OCI_SYM_CORE },
+
+    { "OCINumberToInt",               (POCI_SYMBOL *) &OCINumberToInt,               OCI_SYM_CORE },
+    { "OCINumberFromInt",             (POCI_SYMBOL *) &OCINumberFromInt,             OCI_SYM_CORE },
+    { "OCINumberToReal",              (POCI_SYMBOL *) &OCINumberToReal,              OCI_SYM_CORE },
+    { "OCINumberFromReal",            (POCI_SYMBOL *) &OCINumberFromReal,            OCI_SYM_CORE },
+    { "OCINumberToText",              (POCI_SYMBOL *) &OCINumberToText,              OCI_SYM_CORE },
+    { "OCINumberFromText",            (POCI_SYMBOL *) &OCINumberFromText,            OCI_SYM_CORE },
+    { "OCINumberAssign",              (POCI_SYMBOL *) &OCINumberAssign,              OCI_SYM_CORE },
+    { "OCINumberAdd",                 (POCI_SYMBOL *) &OCINumberAdd,                 OCI_SYM_CORE },
+    { "OCINumberSub",                 (POCI_SYMBOL *) &OCINumberSub,                 OCI_SYM_CORE },
+    { "OCINumberMul",                 (POCI_SYMBOL *) &OCINumberMul,                 OCI_SYM_CORE },
+    { "OCINumberDiv",                 (POCI_SYMBOL *) &OCINumberDiv,                 OCI_SYM_CORE },
+    { "OCINumberCmp",                 (POCI_SYMBOL *) &OCINumberCmp,                 OCI_SYM_CORE },
+
+    { "OCIStringPtr",                 (POCI_SYMBOL *) &OCIStringPtr,                 OCI_SYM_CORE },
+    { "OCIStringSize",                (POCI_SYMBOL *) &OCIStringSize,                OCI_SYM_CORE },
+    { "OCIStringAssignText",          (POCI_SYMBOL *) &OCIStringAssignText,          OCI_SYM_CORE },
+    { "OCIStringResize",              (POCI_SYMBOL *) &OCIStringResize,              OCI_SYM_CORE },
+    { "OCIRawPtr",                    (POCI_SYMBOL *) &OCIRawPtr,                    OCI_SYM_CORE },
+    { "OCIRawAssignBytes",            (POCI_SYMBOL *) &OCIRawAssignBytes,            OCI_SYM_CORE },
+    { "OCIRawResize",                 (POCI_SYMBOL *) &OCIRawResize,                 OCI_SYM_CORE },
+    { "OCIRawAllocSize",              (POCI_SYMBOL *) &OCIRawAllocSize,              OCI_SYM_CORE },
+    { "OCIRawSize",                   (POCI_SYMBOL *) &OCIRawSize,                   OCI_SYM_CORE },
+
+    { "OCIObjectNew",                 (POCI_SYMBOL *) &OCIObjectNew,                 OCI_SYM_CORE },
+    { "OCIObjectFree",                (POCI_SYMBOL *) &OCIObjectFree,                OCI_SYM_CORE },
+    { "OCIObjectSetAttr",             (POCI_SYMBOL *) &OCIObjectSetAttr,             OCI_SYM_CORE },
+    { "OCIObjectGetAttr",             (POCI_SYMBOL *) &OCIObjectGetAttr,             OCI_SYM_CORE },
+    { "OCIObjectPin",                 (POCI_SYMBOL *) &OCIObjectPin,                 OCI_SYM_CORE },
+    { "OCIObjectUnpin",               (POCI_SYMBOL *) &OCIObjectUnpin,               OCI_SYM_CORE },
+    { "OCIObjectCopy",                (POCI_SYMBOL *) &OCIObjectCopy,                OCI_SYM_CORE },
+    { "OCIObjectGetObjectRef",        (POCI_SYMBOL *) &OCIObjectGetObjectRef,        OCI_SYM_CORE },
+    { "OCIObjectGetProperty",         (POCI_SYMBOL *) &OCIObjectGetProperty,         OCI_SYM_CORE },
+    { "OCIObjectGetInd",              (POCI_SYMBOL *) &OCIObjectGetInd,              OCI_SYM_CORE },
+    { "OCIObjectGetTypeRef",          (POCI_SYMBOL *) &OCIObjectGetTypeRef,          OCI_SYM_CORE },
+
+    { "OCIRefAssign",                 (POCI_SYMBOL *) &OCIRefAssign,                 OCI_SYM_CORE },
+    { "OCIRefIsNull",                 (POCI_SYMBOL *) &OCIRefIsNull,                 OCI_SYM_CORE },
+    { "OCIRefClear",                  (POCI_SYMBOL *) &OCIRefClear,                  OCI_SYM_CORE },
+    { "OCIRefToHex",                  (POCI_SYMBOL *) &OCIRefToHex,                  OCI_SYM_CORE },
+    { "OCIRefHexSize",                (POCI_SYMBOL *) &OCIRefHexSize,                OCI_SYM_CORE },
+
+    { "OCIArrayDescriptorAlloc",      (POCI_SYMBOL *) &OCIArrayDescriptorAlloc,      OCI_SYM_CORE },
+    { "OCIArrayDescriptorFree",       (POCI_SYMBOL *) &OCIArrayDescriptorFree,       OCI_SYM_CORE },
+
+    { "OCIClientVersion",             (POCI_SYMBOL *) &OCIClientVersion,             OCI_SYM_CORE },
+
+    { "OCIThreadProcessInit",         (POCI_SYMBOL *) &OCIThreadProcessInit,         OCI_SYM_CORE },
+    { "OCIThreadInit",                (POCI_SYMBOL *) &OCIThreadInit,                OCI_SYM_CORE },
+    { "OCIThreadTerm",                (POCI_SYMBOL *) &OCIThreadTerm,                OCI_SYM_CORE },
+
+    { "OCIThreadIdInit",              (POCI_SYMBOL *) &OCIThreadIdInit,              OCI_SYM_CORE },
+    { "OCIThreadIdDestroy",           (POCI_SYMBOL *) &OCIThreadIdDestroy,           OCI_SYM_CORE },
+    { "OCIThreadHndInit",             (POCI_SYMBOL *) &OCIThreadHndInit,             OCI_SYM_CORE },
+    { "OCIThreadHndDestroy",          (POCI_SYMBOL *) &OCIThreadHndDestroy,          OCI_SYM_CORE },
+    { "OCIThreadCreate",              (POCI_SYMBOL *) &OCIThreadCreate,              OCI_SYM_CORE },
+    { "OCIThreadJoin",                (POCI_SYMBOL *) &OCIThreadJoin,                OCI_SYM_CORE },
+    { "OCIThreadClose",               (POCI_SYMBOL *) &OCIThreadClose,               OCI_SYM_CORE },
+
+    { "OCIThreadMutexInit",           (POCI_SYMBOL *) &OCIThreadMutexInit,           OCI_SYM_CORE },
+    { "OCIThreadMutexDestroy",        (POCI_SYMBOL *) &OCIThreadMutexDestroy,        OCI_SYM_CORE },
+    { "OCIThreadMutexAcquire",        (POCI_SYMBOL *) &OCIThreadMutexAcquire,        OCI_SYM_CORE },
+    { "OCIThreadMutexRelease",        (POCI_SYMBOL *) &OCIThreadMutexRelease,        OCI_SYM_CORE },
+
+    { "OCIThreadKeyInit",             (POCI_SYMBOL *) &OCIThreadKeyInit,             OCI_SYM_CORE },
+    { "OCIThreadKeyDestroy",          (POCI_SYMBOL *) &OCIThreadKeyDestroy,          OCI_SYM_CORE },
+    { "OCIThreadKeySet",              (POCI_SYMBOL *) &OCIThreadKeySet,              OCI_SYM_CORE },
+    { "OCIThreadKeyGet",              (POCI_SYMBOL *) &OCIThreadKeyGet,              OCI_SYM_CORE },
+
+    { "OCIConnectionPoolCreate",      (POCI_SYMBOL *) &OCIConnectionPoolCreate,      OCI_SYM_POOL },
+    { "OCIConnectionPoolDestroy",     (POCI_SYMBOL *) &OCIConnectionPoolDestroy,     OCI_SYM_POOL },
+
+    { "OCISessionPoolCreate",         (POCI_SYMBOL *) &OCISessionPoolCreate,         OCI_SYM_POOL },
+    { "OCISessionPoolDestroy",        (POCI_SYMBOL *) &OCISessionPoolDestroy,        OCI_SYM_POOL },
+
+    { "OCISessionGet",                (POCI_SYMBOL *) &OCISessionGet,                OCI_SYM_POOL },
+    { "OCISessionRelease",            (POCI_SYMBOL *) &OCISessionRelease,            OCI_SYM_POOL },
+
+    { "OCICollSize",                  (POCI_SYMBOL *) &OCICollSize,                  OCI_SYM_COLLECTION },
+    { "OCICollMax",                   (POCI_SYMBOL *) &OCICollMax,                   OCI_SYM_COLLECTION },
+    { "OCICollGetElem",               (POCI_SYMBOL *) &OCICollGetElem,               OCI_SYM_COLLECTION },
+    { "OCICollAssignElem",            (POCI_SYMBOL *) &OCICollAssignElem,            OCI_SYM_COLLECTION },
+    { "OCICollAssign",                (POCI_SYMBOL *) &OCICollAssign,                OCI_SYM_COLLECTION },
+    { "OCICollAppend",                (POCI_SYMBOL *) &OCICollAppend,                OCI_SYM_COLLECTION },
+    { "OCICollTrim",                  (POCI_SYMBOL *) &OCICollTrim,                  OCI_SYM_COLLECTION },
+    { "OCITableDelete",               (POCI_SYMBOL *) &OCITableDelete,               OCI_SYM_COLLECTION },
+    { "OCITableSize",                 (POCI_SYMBOL *) &OCITableSize,                 OCI_SYM_COLLECTION },
+
+    { "OCIIterCreate",                (POCI_SYMBOL *) &OCIIterCreate,                OCI_SYM_COLLECTION },
+    { "OCIIterDelete",                (POCI_SYMBOL *) &OCIIterDelete,                OCI_SYM_COLLECTION },
+    { "OCIIterInit",                  (POCI_SYMBOL *) &OCIIterInit,                  OCI_SYM_COLLECTION },
+    { "OCIIterNext",                  (POCI_SYMBOL *) &OCIIterNext,                  OCI_SYM_COLLECTION },
+    { "OCIIterPrev",                  (POCI_SYMBOL *) &OCIIterPrev,                  OCI_SYM_COLLECTION },
+
+    { "OCIDirPathAbort",              (POCI_SYMBOL *) &OCIDirPathAbort,              OCI_SYM_DIRPATH },
+    { "OCIDirPathDataSave",           (POCI_SYMBOL *) &OCIDirPathDataSave,           OCI_SYM_DIRPATH },
+    { "OCIDirPathFinish",             (POCI_SYMBOL *) &OCIDirPathFinish,             OCI_SYM_DIRPATH },
+    { "OCIDirPathPrepare",            (POCI_SYMBOL *) &OCIDirPathPrepare,            OCI_SYM_DIRPATH },
+    { "OCIDirPathLoadStream",         (POCI_SYMBOL *) &OCIDirPathLoadStream,         OCI_SYM_DIRPATH },
+    { "OCIDirPathColArrayEntrySet",   (POCI_SYMBOL *) &OCIDirPathColArrayEntrySet,   OCI_SYM_DIRPATH },
+    { "OCIDirPathColArrayReset",      (POCI_SYMBOL *) &OCIDirPathColArrayReset,      OCI_SYM_DIRPATH },
+    { "OCIDirPathColArrayToStream",   (POCI_SYMBOL *) &OCIDirPathColArrayToStream,   OCI_SYM_DIRPATH },
+    { "OCIDirPathStreamReset",        (POCI_SYMBOL *) &OCIDirPathStreamReset,        OCI_SYM_DIRPATH },
+    { "OCIDirPathFlushRow",           (POCI_SYMBOL *) &OCIDirPathFlushRow,           OCI_SYM_DIRPATH },
+
+    { "OCICacheFree",                 (POCI_SYMBOL *) &OCICacheFree,                 OCI_SYM_CORE },
+    { "OCIPing",                      (POCI_SYMBOL *) &OCIPing,                      OCI_SYM_CORE },
+
+    { "OCIDBStartup",                 (POCI_SYMBOL *) &OCIDBStartup,                 OCI_SYM_ADMIN },
+    { "OCIDBShutdown",                (POCI_SYMBOL *) &OCIDBShutdown,                OCI_SYM_ADMIN },
+
+    { "OCIStmtPrepare2",              (POCI_SYMBOL *) &OCIStmtPrepare2,              OCI_SYM_CORE },
+    { "OCIStmtRelease",               (POCI_SYMBOL *) &OCIStmtRelease,               OCI_SYM_CORE },
+
+    { "OCISubscriptionRegister",      (POCI_SYMBOL *) &OCISubscriptionRegister,      OCI_SYM_NOTIFY },
+    { "OCISubscriptionUnRegister",    (POCI_SYMBOL *) &OCISubscriptionUnRegister,    OCI_SYM_NOTIFY },
+
+    { "OCIAQEnq",                     (POCI_SYMBOL *) &OCIAQEnq,                     OCI_SYM_QUEUE },
+    { "OCIAQDeq",                     (POCI_SYMBOL *) &OCIAQDeq,                     OCI_SYM_QUEUE },
+    { "OCIAQListen",                  (POCI_SYMBOL *) &OCIAQListen,                  OCI_SYM_QUEUE },
+
+    { "xaoSvcCtx",                    (POCI_SYMBOL *) &xaoSvcCtx,                    OCI_SYM_CORE },
+    { "xaoEnv",                       (POCI_SYMBOL *) &xaoEnv,                       OCI_SYM_CORE },
+
+    { "OCILobGetContentType",         (POCI_SYMBOL *) &OCILobGetContentType,         OCI_SYM_CORE },
+
+    { "OCIStmtGetNextResult",         (POCI_SYMBOL *) &OCIStmtGetNextResult,         OCI_SYM_CORE },
+
+    { "OCIServerRelease2",            (POCI_SYMBOL *) &OCIServerRelease2,            OCI_SYM_CORE },
+
+    { "OCISodaOperKeysSet",           (POCI_SYMBOL *) &OCISodaOperKeysSet,           OCI_SYM_CORE },
+};
+
+/* --------------------------------------------------------------------------------------------- *
+ * EnvironmentResolveSymbols
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int EnvironmentResolveSymbols
+(
+    unsigned int group
+)
+{
+    unsigned int count = 0;
+
+    for (size_t i = 0; i < sizeof(EnvironmentSymbols) / sizeof(EnvironmentSymbols[0]); i++)
+    {
+        const OCI_Symbol *sym = &EnvironmentSymbols[i];
+
+        if (sym->group == group)
+        {
+            LIB_SYMBOL(Env.lib_handle, sym->name, *sym->addr, POCI_SYMBOL);
+
+            count++;
+        }
+    }
+
+    Env.sym_loaded[group] = TRUE;
+
+    return count;
+}
+
 #endif /* OCI_IMPORT_RUNTIME */
 
+/* --------------------------------------------------------------------------------------------- *
+ * EnvironmentGetElapsedTime
+ * --------------------------------------------------------------------------------------------- */
+
+static big_uint EnvironmentGetElapsedTime
+(
+    big_uint *clock
+)
+{
+    const big_uint now     = ClockGetMicroseconds();
+    const big_uint elapsed = now - *clock;
+
+    *clock = now;
+
+    return elapsed;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * EnvironmentFreeErrors
  * --------------------------------------------------------------------------------------------- */
@@ -675,6 +1004,10 @@ boolean EnvironmentInitialize
 
     ub4 oci_mode = OCI_ENV_MODE | OCI_OBJECT;
 
+    const big_uint clock_start = ClockGetMicroseconds();
+
+    big_uint clock_step = clock_start;
+
 #ifdef OCI_IMPORT_RUNTIME
 
     char path[OCI_SIZE_BUFFER+1];
@@ -753,6 +1086,8 @@ boolean EnvironmentInitialize
         }
     }
 
+    Env.init_stats.setup_time = EnvironmentGetElapsedTime(&clock_step);
+
 #ifdef OCI_IMPORT_LINKAGE
 
     OCI_NOT_USED(lib_path)
@@ -804,501 +1139,24 @@ boolean EnvironmentInitialize
     if (Env.lib_handle)
     {
 
-        /* Now loading all symbols - no check is performed on each function,
+        Env.init_stats.library_time = EnvironmentGetElapsedTime(&clock_step);
+
+        /* Now loading symbols - no check is performed on each function,
            Basic checks will be done to ensure we're loading an
            Oracle and compatible library ...
+           In lazy binding mode, only the core symbols are loaded here and
+           other groups are loaded on the first use of their features
         */
 
-        LIB_SYMBOL(Env.lib_handle, "OCIEnvCreate",          OCIEnvCreate,
-                   OCIENVCREATE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIServerAttach",       OCIServerAttach,
-                   OCISERVERATTACH);
-        LIB_SYMBOL(Env.lib_handle, "OCIServerDetach",       OCIServerDetach,
-                   OCISERVERDETACH);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIHandleAlloc",        OCIHandleAlloc,
-                   OCIHANDLEALLOC);
-        LIB_SYMBOL(Env.lib_handle, "OCIHandleFree",         OCIHandleFree,
-                   OCIHANDLEFREE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIDescriptorAlloc",    OCIDescriptorAlloc,
-                   OCIDESCRIPTORALLOC);
-        LIB_SYMBOL(Env.lib_handle, "OCIDescriptorFree",     OCIDescriptorFree,
-                   OCIDESCRIPTORFREE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIAttrSet",            OCIAttrSet,
-                   OCIATTRSET);
-        LIB_SYMBOL(Env.lib_handle, "OCIAttrGet",            OCIAttrGet,
-                   OCIATTRGET);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIParamSet",           OCIParamSet,
-                   OCIPARAMSET);
-        LIB_SYMBOL(Env.lib_handle, "OCIParamGet",           OCIParamGet,
-                   OCIPARAMGET);
-
-        LIB_SYMBOL(Env.lib_handle, "OCISessionBegin",       OCISessionBegin,
-                   OCISESSIONBEGIN);
-        LIB_SYMBOL(Env.lib_handle, "OCISessionEnd",         OCISessionEnd,
-                   OCISESSIONEND);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIPasswordChange",     OCIPasswordChange,
-                   OCIPASSWORDCHANGE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCITransStart",         OCITransStart,
-                   OCITRANSSTART);
-        LIB_SYMBOL(Env.lib_handle, "OCITransDetach",        OCITransDetach,
-                   OCITRANSDETACH);
-        LIB_SYMBOL(Env.lib_handle, "OCITransPrepare",       OCITransPrepare,
-                   OCITRANSPREPARE);
-        LIB_SYMBOL(Env.lib_handle, "OCITransForget",        OCITransForget,
-                   OCITRANSFORGET);
-        LIB_SYMBOL(Env.lib_handle, "OCITransCommit",        OCITransCommit,
-                   OCITRANSCOMMIT);
-        LIB_SYMBOL(Env.lib_handle, "OCITransRollback",      OCITransRollback,
-                   OCITRANSROLLBACK);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIErrorGet",           OCIErrorGet,
-                   OCIERRORGET);
-        LIB_SYMBOL(Env.lib_handle, "OCIServerVersion",      OCIServerVersion,
-                   OCISERVERVERSION);
-        LIB_SYMBOL(Env.lib_handle, "OCIBreak",              OCIBreak,
-                   OCIBREAK);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIBindByPos",          OCIBindByPos,
-                   OCIBINDBYPOS);
-        LIB_SYMBOL(Env.lib_handle, "OCIBindByName",         OCIBindByName,
-                   OCIBINDBYNAME);
-        LIB_SYMBOL(Env.lib_handle, "OCIBindDynamic",        OCIBindDynamic,
-                   OCIBINDDYNAMIC);
-        LIB_SYMBOL(Env.lib_handle, "OCIBindObject",         OCIBindObject,
-                   OCIBINDOBJECT);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIDefineByPos",        OCIDefineByPos,
-                   OCIDEFINEBYPOS);
-        LIB_SYMBOL(Env.lib_handle, "OCIDefineObject",       OCIDefineObject,
-                   OCIDEFINEOBJECT);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtPrepare",        OCIStmtPrepare,
-                   OCISTMTPREPARE);
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtExecute",        OCIStmtExecute,
-                   OCISTMTEXECUTE);
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtFetch",          OCIStmtFetch,
-                   OCISTMTFETCH);
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtFetch2",         OCIStmtFetch2,
-                   OCISTMTFETCH2);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtGetPieceInfo",   OCIStmtGetPieceInfo,
-                   OCISTMTGETPIECEINFO);
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtSetPieceInfo",   OCIStmtSetPieceInfo,
-                   OCISTMTSETPIECEINFO);
-
-        LIB_SYMBOL(Env.lib_handle, "OCILobCreateTemporary", OCILobCreateTemporary,
-                   OCILOBCREATETEMPORARY);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFreeTemporary",   OCILobFreeTemporary,
-                   OCILOBFREETEMPORARY);
-        LIB_SYMBOL(Env.lib_handle, "OCILobIsTemporary",     OCILobIsTemporary,
-                   OCILOBISTEMPORARY);
-        LIB_SYMBOL(Env.lib_handle, "OCILobRead",            OCILobRead,
-                   OCILOBREAD);
-        LIB_SYMBOL(Env.lib_handle, "OCILobWrite",           OCILobWrite,
-                   OCILOBWRITE);
-        LIB_SYMBOL(Env.lib_handle, "OCILobCopy",            OCILobCopy,
-                   OCILOBCOPY);
-        LIB_SYMBOL(Env.lib_handle, "OCILobTrim",            OCILobTrim,
-                   OCILOBTRIM);
-        LIB_SYMBOL(Env.lib_handle, "OCILobErase",           OCILobErase,
-                   OCILOBERASE);
-        LIB_SYMBOL(Env.lib_handle, "OCILobAppend",          OCILobAppend,
-                   OCILOBAPPEND);
-        LIB_SYMBOL(Env.lib_handle, "OCILobGetLength",       OCILobGetLength,
-                   OCILOBGETLENGTH);
-        LIB_SYMBOL(Env.lib_handle, "OCILobGetChunkSize",    OCILobGetChunkSize,
-                   OCILOBGETCHUNKSIZE);
-        LIB_SYMBOL(Env.lib_handle, "OCILobOpen",            OCILobOpen,
-                   OCILOBOPEN);
-        LIB_SYMBOL(Env.lib_handle, "OCILobClose",           OCILobClose,
-                   OCILOBCLOSE);
-
-  #ifdef ORAXB8_DEFINED
-
-        LIB_SYMBOL(Env.lib_handle, "OCILobCopy2",         OCILobCopy2,
-                   OCILOBCOPY2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobErase2",        OCILobErase2,
-                   OCILOBERASE2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobGetLength2",    OCILobGetLength2,
-                   OCILOBGETLENGTH2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobLoadFromFile2", OCILobLoadFromFile2,
-                   OCILOBLOADFROMFILE2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobRead2",         OCILobRead2,
-                   OCILOBREAD2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobTrim2",         OCILobTrim2,
-                   OCILOBTRIM2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobWrite2",        OCILobWrite2,
-                   OCILOBWRITE2);
-        LIB_SYMBOL(Env.lib_handle, "OCILobWriteAppend2",    OCILobWriteAppend2,
-                   OCILOBWRITEAPPEND2);
-
-  #endif
+        for (i = 0; i < OCI_SYM_COUNT; i++)
+        {
+            if ((OCI_SYM_CORE == i) || !(mode & OCI_ENV_LAZY_BINDING))
+            {
+                Env.init_stats.symbols_count += EnvironmentResolveSymbols(i);
+            }
+        }
 
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileOpen",               OCILobFileOpen,
-                   OCILOBFILEOPEN);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileClose",              OCILobFileClose,
-                   OCILOBFILECLOSE);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileCloseAll",           OCILobFileCloseAll,
-                   OCILOBFILECLOSEALL);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileIsOpen",             OCILobFileIsOpen,
-                   OCILOBFILEISOPEN);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileExists",             OCILobFileExists,
-                   OCILOBFILEEXISTS);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileGetName",            OCILobFileGetName,
-                   OCILOBFIELGETNAME);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFileSetName",            OCILobFileSetName,
-                   OCILOBFILESETNAME);
-        LIB_SYMBOL(Env.lib_handle, "OCILobLoadFromFile",           OCILobLoadFromFile,
-                   OCILOBLOADFROMFILE);
-        LIB_SYMBOL(Env.lib_handle, "OCILobWriteAppend",            OCILobWriteAppend,
-                   OCILOBWRITEAPPEND);
-        LIB_SYMBOL(Env.lib_handle, "OCILobIsEqual",                OCILobIsEqual,
-                   OCILOBISEQUAL);
-        LIB_SYMBOL(Env.lib_handle, "OCILobAssign",                 OCILobAssign,
-                   OCILOBASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCILobLocatorAssign",          OCILobLocatorAssign,
-                   OCILOBLOCATORASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCILobFlushBuffer",            OCILobFlushBuffer,
-                   OCILOBFLUSHBUFFER);
-        LIB_SYMBOL(Env.lib_handle, "OCILobGetStorageLimit",        OCILobGetStorageLimit,
-                   OCILOBGETSTORAGELIMIT);
-        LIB_SYMBOL(Env.lib_handle, "OCILobEnableBuffering",        OCILobEnableBuffering,
-                   OCILOBENABLEBUFFERING);
-        LIB_SYMBOL(Env.lib_handle, "OCILobDisableBuffering",       OCILobDisableBuffering,
-                   OCILOBDISABLEBUFFERING);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIDateAssign",                OCIDateAssign,
-                   OCIDATEASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateToText",                OCIDateToText,
-                   OCIDATETOTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateFromText",              OCIDateFromText,
-                   OCIDATEFROMTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateCompare",               OCIDateCompare,
-                   OCIDATECOMPARE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateAddMonths",             OCIDateAddMonths,
-                   OCIDATEADDMONTHS);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateAddDays",               OCIDateAddDays,
-                   OCIDATEADDDAYS);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateLastDay",               OCIDateLastDay,
-                   OCIDATELASTDAY);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateDaysBetween",           OCIDateDaysBetween,
-                   OCIDATEDAYSBETWEEN);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateZoneToZone",            OCIDateZoneToZone,
-                   OCIDATEZONETOZONE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateNextDay",               OCIDateNextDay,
-                   OCIDATENEXTDAY);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateCheck",                 OCIDateCheck,
-                   OCIDATECHECK);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateSysDate",               OCIDateSysDate,
-                   OCIDATESYSDATE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDescribeAny",               OCIDescribeAny,
-                   OCIDESCRIBEANY);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalAssign",            OCIIntervalAssign,
-                   OCIINTERVALASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalCheck",             OCIIntervalCheck,
-                   OCIINTERVALCHECK);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalCompare",           OCIIntervalCompare,
-                   OCIINTERVALCOMPARE);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalFromText",          OCIIntervalFromText,
-                   OCIINTERVALFROMTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalToText",            OCIIntervalToText,
-                   OCIINTERVALTOTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalFromTZ",            OCIIntervalFromTZ,
-                   OCIINTERVALFROMTZ);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalGetDaySecond",      OCIIntervalGetDaySecond,
-                   OCIINTERVALGETDAYSECOND);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalGetYearMonth",      OCIIntervalGetYearMonth,
-                   OCIINTERVALGETYEARMONTH);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalSetDaySecond",      OCIIntervalSetDaySecond,
-                   OCIINTERVALSETDAYSECOND);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalSetYearMonth",      OCIIntervalSetYearMonth,
-                   OCIINTERVALSETYEARMONTH);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalSubtract",          OCIIntervalSubtract,
-                   OCIINTERVALSUBTRACT);
-        LIB_SYMBOL(Env.lib_handle, "OCIIntervalAdd",               OCIIntervalAdd,
-                   OCIINTERVALADD);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeAssign",            OCIDateTimeAssign,
-                   OCIDATETIMEASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeCheck",             OCIDateTimeCheck,
-                   OCIDATETIMECHECK);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeCompare",           OCIDateTimeCompare,
-                   OCIDATETIMECOMPARE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeConstruct",         OCIDateTimeConstruct,
-                   OCIDATETIMECONSTRUCT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeConvert",           OCIDateTimeConvert,
-                   OCIDATETIMECONVERT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeFromArray",         OCIDateTimeFromArray,
-                   OCIDATETIMEFROMARRAY);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeToArray",           OCIDateTimeToArray,
-                   OCIDATETIMETOARRAY);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeFromText",          OCIDateTimeFromText,
-                   OCIDATETIMEFROMTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeToText",            OCIDateTimeToText,
-                   OCIDATETIMETOTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeGetDate",           OCIDateTimeGetDate,
-                   OCIDATETIMEGETDATE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeGetTime",           OCIDateTimeGetTime,
-                   OCIDATETIMEGETTIME);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeGetTimeZoneName",   OCIDateTimeGetTimeZoneName,
-                   OCIDATETIMEGETTIMEZONENAME);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeGetTimeZoneOffset", OCIDateTimeGetTimeZoneOffset,
-                   OCIDATETIMEGETTIMEZONEOFFSET);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeIntervalAdd",       OCIDateTimeIntervalAdd,
-                   OCIDATETIMEINTERVALADD);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeIntervalSub",       OCIDateTimeIntervalSub,
-                   OCIDATETIMEINTERVALSUB);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeSubtract",          OCIDateTimeSubtract,
-                   OCIDATETIMESUBTRACT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDateTimeSysTimeStamp",      OCIDateTimeSysTimeStamp,
-                   OCIDATETIMESYSTIMESTAMP);
-
-        LIB_SYMBOL(Env.lib_handle, "OCITypeByRef",                 OCITypeByRef,
-                   OCITYPEBYREF);
-
-        LIB_SYMBOL(Env.lib_handle, "OCINumberToInt",               OCINumberToInt,
-                   OCINUMBERTOINT);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberFromInt",             OCINumberFromInt,
-                   OCINUMBERFROMINT);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberToReal",              OCINumberToReal,
-                   OCINUMBERTOREAL);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberFromReal",            OCINumberFromReal,
-                   OCINUMBERFROMREAL);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberToText",              OCINumberToText,
-                   OCINUMBERTOTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberFromText",            OCINumberFromText,
-                   OCINUMBERFROMTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberAssign",              OCINumberAssign,
-                   OCINUMBERASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberAdd",                 OCINumberAdd,
-                   OCINUMBERADD);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberSub",                 OCINumberSub,
-                   OCINUMBERSUB);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberMul",                 OCINumberMul,
-                   OCINUMBERMUL);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberDiv",                 OCINumberDiv,
-                   OCINUMBERDIV);
-        LIB_SYMBOL(Env.lib_handle, "OCINumberCmp",                 OCINumberCmp,
-                   OCINUMBERCMP);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIStringPtr",                 OCIStringPtr,
-                   OCISTRINGPTR);
-        LIB_SYMBOL(Env.lib_handle, "OCIStringSize",                OCIStringSize,
-                   OCISTRINGSIZE);
-        LIB_SYMBOL(Env.lib_handle, "OCIStringAssignText",          OCIStringAssignText,
-                   OCISTRINGASSIGNTEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIStringResize",              OCIStringResize,
-                   OCISTRINGRESIZE);
-        LIB_SYMBOL(Env.lib_handle, "OCIRawPtr",                    OCIRawPtr,
-                   OCIRAWPTR);
-        LIB_SYMBOL(Env.lib_handle, "OCIRawAssignBytes",            OCIRawAssignBytes,
-                   OCIRAWASSIGNBYTES);
-        LIB_SYMBOL(Env.lib_handle, "OCIRawResize",                 OCIRawResize,
-                   OCIRAWRESIZE);
-        LIB_SYMBOL(Env.lib_handle, "OCIRawAllocSize",              OCIRawAllocSize,
-                   OCIRAWALLOCSIZE);
-        LIB_SYMBOL(Env.lib_handle, "OCIRawSize",                   OCIRawSize,
-                   OCIRAWSIZE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectNew",                 OCIObjectNew,
-                   OCIOBJECTNEW);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectFree",                OCIObjectFree,
-                   OCIOBJECTFREE);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectSetAttr",             OCIObjectSetAttr,
-                   OCIOBJECTSETATTR);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectGetAttr",             OCIObjectGetAttr,
-                   OCIOBJECTGETATTR);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectPin",                 OCIObjectPin,
-                   OCIOBJECTPIN);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectUnpin",               OCIObjectUnpin,
-                   OCIOBJECTUNPIN);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectCopy",                OCIObjectCopy,
-                   OCIOBJECTCOPY);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectGetObjectRef",        OCIObjectGetObjectRef,
-                   OCIOBJECTGETOBJECTREF);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectGetProperty",         OCIObjectGetProperty,
-                   OCIOBJECTGETPROPERTY);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectGetInd",              OCIObjectGetInd,
-                   OCIOBJECTGETIND);
-        LIB_SYMBOL(Env.lib_handle, "OCIObjectGetTypeRef",          OCIObjectGetTypeRef,
-                   OCIOBJECTGETOBJECTREF);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIRefAssign",                 OCIRefAssign,
-                   OCIREFASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCIRefIsNull",                 OCIRefIsNull,
-                   OCIREFISNULL);
-        LIB_SYMBOL(Env.lib_handle, "OCIRefClear",                  OCIRefClear,
-                   OCIREFCLEAR);
-        LIB_SYMBOL(Env.lib_handle, "OCIRefToHex",                  OCIRefToHex,
-                   OCIREFTOHEX);
-        LIB_SYMBOL(Env.lib_handle, "OCIRefHexSize",                OCIRefHexSize,
-                   OCIREFHEXSIZE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIArrayDescriptorAlloc",      OCIArrayDescriptorAlloc,
-                   OCIARRAYDESCRIPTORALLOC);
-        LIB_SYMBOL(Env.lib_handle, "OCIArrayDescriptorFree",       OCIArrayDescriptorFree,
-                   OCIARRAYDESCRIPTORFREE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIClientVersion",             OCIClientVersion,
-                   OCICLIENTVERSION);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadProcessInit",         OCIThreadProcessInit,
-                   OCITHREADPROCESSINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadInit",                OCIThreadInit,
-                   OCITHREADINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadTerm",                OCIThreadTerm,
-                   OCITHREADTERM);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadIdInit",              OCIThreadIdInit,
-                   OCITHREADIDINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadIdDestroy",           OCIThreadIdDestroy,
-                   OCITHREADIDDESTROY);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadHndInit",             OCIThreadHndInit,
-                   OCITHREADHNDINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadHndDestroy",          OCIThreadHndDestroy,
-                   OCITHREADHNDDESTROY);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadCreate",              OCIThreadCreate,
-                   OCITHREADCREATE);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadJoin",                OCIThreadJoin,
-                   OCITHREADJOIN);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadClose",               OCIThreadClose,
-                   OCITHREADCLOSE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadMutexInit",           OCIThreadMutexInit,
-                   OCITHREADMUTEXINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadMutexDestroy",        OCIThreadMutexDestroy,
-                   OCITHREADMUTEXDESTROY);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadMutexAcquire",        OCIThreadMutexAcquire,
-                   OCITHREADMUTEXACQUIRE);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadMutexRelease",        OCIThreadMutexRelease,
-                   OCITHREADMUTEXRELEASE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadKeyInit",             OCIThreadKeyInit,
-                   OCITHREADKEYINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadKeyDestroy",          OCIThreadKeyDestroy,
-                   OCITHREADKEYDESTROY);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadKeySet",              OCIThreadKeySet,
-                   OCITHREADKEYSET);
-        LIB_SYMBOL(Env.lib_handle, "OCIThreadKeyGet",              OCIThreadKeyGet,
-                   OCITHREADKEYGET);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIConnectionPoolCreate",      OCIConnectionPoolCreate,
-                   OCICONNECTIONPOOLCREATE);
-        LIB_SYMBOL(Env.lib_handle, "OCIConnectionPoolDestroy",     OCIConnectionPoolDestroy,
-                   OCICONNECTIONPOOLDESTROY);
-
-        LIB_SYMBOL(Env.lib_handle, "OCISessionPoolCreate",         OCISessionPoolCreate,
-                   OCISESSIONPOOLCREATE);
-        LIB_SYMBOL(Env.lib_handle, "OCISessionPoolDestroy",        OCISessionPoolDestroy,
-                   OCISESSIONPOOLDESTROY);
-
-        LIB_SYMBOL(Env.lib_handle, "OCISessionGet",                OCISessionGet,
-                   OCISESSIONGET);
-        LIB_SYMBOL(Env.lib_handle, "OCISessionRelease",            OCISessionRelease,
-                   OCISESSIONRELEASE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCICollSize",                  OCICollSize,
-                   OCICOLLSIZE);
-        LIB_SYMBOL(Env.lib_handle, "OCICollMax",                   OCICollMax,
-                   OCICOLLMAX);
-        LIB_SYMBOL(Env.lib_handle, "OCICollGetElem",               OCICollGetElem,
-                   OCICOLLGETITEM);
-        LIB_SYMBOL(Env.lib_handle, "OCICollAssignElem",            OCICollAssignElem,
-                   OCICOLLASSIGNELEM);
-        LIB_SYMBOL(Env.lib_handle, "OCICollAssign",                OCICollAssign,
-                   OCICOLLASSIGN);
-        LIB_SYMBOL(Env.lib_handle, "OCICollAppend",                OCICollAppend,
-                   OCICOLLAPPEND);
-        LIB_SYMBOL(Env.lib_handle, "OCICollTrim",                  OCICollTrim,
-                   OCICOLLTRIM);
-        LIB_SYMBOL(Env.lib_handle, "OCITableDelete",               OCITableDelete,
-                   OCITABLEDELETE);
-        LIB_SYMBOL(Env.lib_handle, "OCITableSize",                 OCITableSize,
-                   OCITABLESIZE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIIterCreate",                OCIIterCreate,
-                   OCIITERCREATE);
-        LIB_SYMBOL(Env.lib_handle, "OCIIterDelete",                OCIIterDelete,
-                   OCIITERDELETE);
-        LIB_SYMBOL(Env.lib_handle, "OCIIterInit",                  OCIIterInit,
-                   OCIITERINIT);
-        LIB_SYMBOL(Env.lib_handle, "OCIIterNext",                  OCIIterNext,
-                   OCIITERNEXT);
-        LIB_SYMBOL(Env.lib_handle, "OCIIterPrev",                  OCIIterPrev,
-                   OCIITERPREV);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathAbort",              OCIDirPathAbort,
-                   OCIDIRPATHABORT);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathDataSave",           OCIDirPathDataSave,
-                   OCIDIRPATHDATASAVE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathFinish",             OCIDirPathFinish,
-                   OCIDIRPATHFINISH);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathPrepare",            OCIDirPathPrepare,
-                   OCIDIRPATHPREPARE);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathLoadStream",         OCIDirPathLoadStream,
-                   OCIDIRPATHLOADSTREAM);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayEntrySet",   OCIDirPathColArrayEntrySet,
-                   OCIDIRPATHCOLARRAYENTRYSET);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayReset",      OCIDirPathColArrayReset,
-                   OCIDIRPATHCOLARRAYRESET);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayToStream",   OCIDirPathColArrayToStream,
-                   OCIDIRPATHCOLARRAYTOSTREAM);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathStreamReset",        OCIDirPathStreamReset,
-                   OCIDIRPATHSTREAMRESET);
-        LIB_SYMBOL(Env.lib_handle, "OCIDirPathFlushRow",           OCIDirPathFlushRow,
-                   OCIDIRPATHFLUSHROW);
-
-        LIB_SYMBOL(Env.lib_handle, "OCICacheFree",                 OCICacheFree,
-                   OCICACHEFREE);
-        LIB_SYMBOL(Env.lib_handle, "OCIPing",                      OCIPing,
-                   OCIPING);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIDBStartup",                 OCIDBStartup,
-                   OCIDBSTARTUP);
-        LIB_SYMBOL(Env.lib_handle, "OCIDBShutdown",                OCIDBShutdown,
-                   OCIDBSHUTDOWN);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtPrepare2",              OCIStmtPrepare2,
-                   OCISTMTPREPARE2);
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtRelease",               OCIStmtRelease,
-                   OCISTMTRELEASE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCISubscriptionRegister",      OCISubscriptionRegister,
-                   OCISUBSCRIPTIONREGISTER);
-        LIB_SYMBOL(Env.lib_handle, "OCISubscriptionUnRegister",    OCISubscriptionUnRegister,
-                   OCISUBSCRIPTIONUNREGISTER);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIAQEnq",                     OCIAQEnq,
-                   OCIAQENQ);
-        LIB_SYMBOL(Env.lib_handle, "OCIAQDeq",                     OCIAQDeq,
-                   OCIAQDEQ);
-        LIB_SYMBOL(Env.lib_handle, "OCIAQListen",                  OCIAQListen,
-                   OCIAQLISTEN);
-
-        LIB_SYMBOL(Env.lib_handle, "xaoSvcCtx",                    xaoSvcCtx,
-                   XAOSVCCTX);
-        LIB_SYMBOL(Env.lib_handle, "xaoEnv",                       xaoEnv,
-                   XAOENV);
-
-        LIB_SYMBOL(Env.lib_handle, "OCILobGetContentType",         OCILobGetContentType,
-                   OCILOBGETCONTENTTYPE);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIStmtGetNextResult",         OCIStmtGetNextResult,
-                   OCISTMTGETNEXTRESULT);
-
-        LIB_SYMBOL(Env.lib_handle, "OCIServerRelease2",            OCIServerRelease2,
-                   OCISERVERRELEASE2);
-
-        LIB_SYMBOL(Env.lib_handle, "OCISodaOperKeysSet",           OCISodaOperKeysSet,
-                   OCISODAOPERKEYSSET);
+        Env.init_stats.symbols_time = EnvironmentGetElapsedTime(&clock_step);
 
         /* API Version checking */
 
@@ -1427,6 +1285,8 @@ boolean EnvironmentInitialize
         THROW_NO_ARGS(ExceptionOCIEnvironment)
     }
 
+    Env.init_stats.environment_time = EnvironmentGetElapsedTime(&clock_step);
+
     /* on success, we need to initialize OCIThread object support */
 
     if (LIB_THREADED)
@@ -1441,6 +1301,19 @@ boolean EnvironmentInitialize
 
         Env.mem_mutex= MutexCreateInternal();
         CHECK_NULL(Env.mem_mutex)
+
+        Env.fmt_lock = RWLockCreateInternal();
+        CHECK_NULL(Env.fmt_lock)
+
+        Env.key_lock = RWLockCreateInternal();
+        CHECK_NULL(Env.key_lock)
+
+#ifdef OCI_IMPORT_RUNTIME
+
+        Env.sym_mutex = MutexCreateInternal();
+        CHECK_NULL(Env.sym_mutex)
+
+#endif
     }
 
     /* create thread key for thread errors */
@@ -1463,6 +1336,16 @@ boolean EnvironmentInitialize
     Env.arrs = ListCreate(OCI_IPC_ARRAY);
     CHECK_NULL(Env.arrs)
 
+    /* allocate pool routers internal list */
+
+    Env.routers = ListCreate(OCI_IPC_POOL_ROUTER);
+    CHECK_NULL(Env.routers)
+
+    /* allocate direct path loaders internal list */
+
+    Env.dpls = ListCreate(OCI_IPC_DIRPATH_LOADER);
+    CHECK_NULL(Env.dpls)
+
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
     /* allocate connection pools internal list */
@@ -1472,6 +1355,9 @@ boolean EnvironmentInitialize
 
 #endif
 
+    Env.init_stats.objects_time = EnvironmentGetElapsedTime(&clock_step);
+    Env.init_stats.total_time   = clock_step - clock_start;
+
     Env.loaded = TRUE;
 
     /* test for XA support */
@@ -1514,6 +1400,22 @@ boolean EnvironmentCleanup
 
     success = TRUE;
 
+    /* join direct path loader workers before their sessions get disposed */
+
+    ListForEach(Env.dpls, (POCI_LIST_FOR_EACH)DirPathLoaderDispose);
+
+    /* dispose pool routers before the pools they own */
+
+    ListForEach(Env.routers, (POCI_LIST_FOR_EACH)PoolRouterDispose);
+
+    /* stop pool health keepers before their connections get disposed */
+
+    ListForEach(Env.pools, (POCI_LIST_FOR_EACH)PoolStopKeeper);
+
+    /* return connections bound to threads while they are still valid */
+
+    ListForEach(Env.pools, (POCI_LIST_FOR_EACH)PoolReleaseThreadConnections);
+
     /* dispose list items */
 
     ListForEach(Env.arrs,  (POCI_LIST_FOR_EACH)ArrayDispose);
@@ -1521,6 +1423,16 @@ boolean EnvironmentCleanup
     ListForEach(Env.cons,  (POCI_LIST_FOR_EACH)ConnectionDispose);
     ListForEach(Env.pools, (POCI_LIST_FOR_EACH)PoolDispose);
 
+    /* free all direct path loaders */
+
+    ListClear(Env.dpls);
+    ListFree(Env.dpls);
+
+    /* free all pool routers */
+
+    ListClear(Env.routers);
+    ListFree(Env.routers);
+
     /* free all arrays */
 
     ListClear(Env.arrs);
@@ -1545,8 +1457,14 @@ boolean EnvironmentCleanup
 
     KeyMapFree();
 
+    /* free format templates */
+
+    FormatFreeTemplates();
+
     Env.cons    = NULL;
     Env.pools   = NULL;
+    Env.routers = NULL;
+    Env.dpls    = NULL;
     Env.subs    = NULL;
     Env.key_map = NULL;
 
@@ -1563,6 +1481,31 @@ boolean EnvironmentCleanup
            it would generate an OCI error when calling MemoryAllocHandle() for freeing the mutex object error handle
         */
 
+        if (NULL != Env.fmt_lock)
+        {
+            RWLockFree(Env.fmt_lock);
+
+            Env.fmt_lock = NULL;
+        }
+
+        if (NULL != Env.key_lock)
+        {
+            RWLockFree(Env.key_lock);
+
+            Env.key_lock = NULL;
+        }
+
+#ifdef OCI_IMPORT_RUNTIME
+
+        if (NULL != Env.sym_mutex)
+        {
+            MutexFree(Env.sym_mutex);
+
+            Env.sym_mutex = NULL;
+        }
+
+#endif
+
         OCI_Mutex * mutex = Env.mem_mutex;
 
         Env.mem_mutex = NULL;
@@ -1766,6 +1709,95 @@ big_uint EnvironmentGetAllocatedBytes
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * EnvironmentGetInitStatistics
+ * --------------------------------------------------------------------------------------------- */
+
+boolean EnvironmentGetInitStatistics
+(
+    OCI_InitStatistics *stats
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_INITIALIZED()
+    CHECK_PTR(OCI_IPC_VOID, stats)
+
+    if (NULL != Env.sym_mutex)
+    {
+        CHECK(MutexAcquire(Env.sym_mutex))
+
+        locked = TRUE;
+    }
+
+    *stats = Env.init_stats;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(Env.sym_mutex);
+        }
+    )
+}
+
+#ifdef OCI_IMPORT_RUNTIME
+
+/* --------------------------------------------------------------------------------------------- *
+ * EnvironmentLoadSymbols
+ * --------------------------------------------------------------------------------------------- */
+
+boolean EnvironmentLoadSymbols
+(
+    unsigned int group
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    boolean locked = FALSE;
+
+    if (NULL != Env.sym_mutex)
+    {
+        CHECK(MutexAcquire(Env.sym_mutex))
+
+        locked = TRUE;
+    }
+
+    /* another thread may have loaded the group while we were waiting */
+
+    if (!Env.sym_loaded[group])
+    {
+        big_uint clock = ClockGetMicroseconds();
+
+        Env.init_stats.lazy_count += EnvironmentResolveSymbols(group);
+        Env.init_stats.lazy_time  += EnvironmentGetElapsedTime(&clock);
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(Env.sym_mutex);
+        }
+    )
+}
+
+#endif
+
 /* --------------------------------------------------------------------------------------------- *
  * EnvironmentGetLastError
  * --------------------------------------------------------------------------------------------- */
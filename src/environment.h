@@ -65,6 +65,20 @@ unsigned int EnvironmentGetCharset
     void
 );
 
+boolean EnvironmentGetInitStatistics
+(
+    OCI_InitStatistics *stats
+);
+
+#ifdef OCI_IMPORT_RUNTIME
+
+boolean EnvironmentLoadSymbols
+(
+    unsigned int group
+);
+
+#endif
+
 big_uint EnvironmentGetAllocatedBytes
 (
     unsigned int mem_type
@@ -69,6 +69,8 @@ static const otext * TypeNames[OCI_IPC_COUNT] =
     OTEXT("Enqueue handle"),
     OTEXT("Dequeue handle"),
     OTEXT("Agent handle"),
+    OTEXT("Pool router handle"),
+    OTEXT("Direct path loader handle"),
 
     OTEXT("Internal list handle"),
     OTEXT("Internal list item handle"),
@@ -91,7 +93,13 @@ static const otext * TypeNames[OCI_IPC_COUNT] =
     OTEXT("Internal Long handle data buffer"),
     OTEXT("Internal trace info structure"),
     OTEXT("Internal array of direct path columns"),
-    OTEXT("Internal array of batch error objects")
+    OTEXT("Internal array of batch error objects"),
+    OTEXT("Internal array of statement handles"),
+    OTEXT("Internal format template structure"),
+    OTEXT("Internal array of connection handles"),
+    OTEXT("Internal reader/writer lock"),
+    OTEXT("Internal array of direct path workers"),
+    OTEXT("Internal array of pool router entries")
 };
 
 #if defined(OCI_CHARSET_WIDE) && !defined(_MSC_VER)
@@ -129,7 +137,12 @@ static const otext * ErrorMessages[OCI_ERR_COUNT] =
     OTEXT("Cannot retrieve OCI environment from XA connection string '%ls'"),
     OTEXT("Cannot connect to database using XA connection string '%ls'"),
     OTEXT("Binding '%ls': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
-    OTEXT("Found %d non freed allocated bytes")
+    OTEXT("Found %d non freed allocated bytes"),
+    OTEXT("A non blocking call is still executing on the statement"),
+    OTEXT("Cannot open or map file '%ls'"),
+    OTEXT("A parallel worker failed with error code %d"),
+    OTEXT("The pool is owned by a pool router"),
+    OTEXT("The statement has already been released")
 };
 
 #else
@@ -167,7 +180,12 @@ static const otext * ErrorMessages[OCI_ERR_COUNT] =
     OTEXT("Cannot retrieve OCI environment from XA connection string '%s'"),
     OTEXT("Cannot connect to database using XA connection string '%s'"),
     OTEXT("Binding '%s': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
-    OTEXT("Found %d non freed allocated bytes")
+    OTEXT("Found %d non freed allocated bytes"),
+    OTEXT("A non blocking call is still executing on the statement"),
+    OTEXT("Cannot open or map file '%s'"),
+    OTEXT("A parallel worker failed with error code %d"),
+    OTEXT("The pool is owned by a pool router"),
+    OTEXT("The statement has already been released")
 };
 
 #endif
@@ -183,7 +201,8 @@ static const otext * OracleFeatures[OCI_FEATURE_COUNT] =
     OTEXT("Oracle 10g R2 remote database startup/shutdown"),
     OTEXT("Oracle 10g R2 High Availability"),
     OTEXT("Oracle XA Connections"),
-    OTEXT("Oracle 12c R1 PL/SQL extended support")
+    OTEXT("Oracle 12c R1 PL/SQL extended support"),
+    OTEXT("Oracle 11g R1 LOB array writes")
 };
 
 typedef struct StatementState
@@ -790,4 +809,66 @@ void ExceptionExternalBindingNotAllowed
 )
 {
     EXCEPTION_IMPL(OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED, bind)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* ExceptionAsyncCallPending
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionAsyncCallPending
+(
+    OCI_Context* ctx
+)
+{
+    EXCEPTION_IMPL_NO_ARGS(OCI_ERR_ASYNC_CALL_PENDING)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* ExceptionFileAccess
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionFileAccess
+(
+    OCI_Context * ctx,
+    const otext * filename
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_FILE_ACCESS, filename)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* ExceptionWorkerFailed
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionWorkerFailed
+(
+    OCI_Context *ctx,
+    int          code
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_WORKER_FAILED, code)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* ExceptionPoolRouted
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionPoolRouted
+(
+    OCI_Context *ctx
+)
+{
+    EXCEPTION_IMPL_NO_ARGS(OCI_ERR_POOL_ROUTED)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+* ExceptionStatementReleased
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionStatementReleased
+(
+    OCI_Context *ctx
+)
+{
+    EXCEPTION_IMPL_NO_ARGS(OCI_ERR_STMT_RELEASED)
 }
\ No newline at end of file
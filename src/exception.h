@@ -220,4 +220,31 @@ void ExceptionExternalBindingNotAllowed
     const otext * bind
 );
 
+void ExceptionAsyncCallPending
+(
+    OCI_Context * ctx
+);
+
+void ExceptionFileAccess
+(
+    OCI_Context * ctx,
+    const otext * filename
+);
+
+void ExceptionWorkerFailed
+(
+    OCI_Context *ctx,
+    int          code
+);
+
+void ExceptionPoolRouted
+(
+    OCI_Context *ctx
+);
+
+void ExceptionStatementReleased
+(
+    OCI_Context *ctx
+);
+
 #endif /* OCILIB_EXCEPTION_H_INCLUDED */
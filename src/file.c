@@ -58,6 +58,8 @@ OCI_File * FileInitialize
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
+    CHECK_SYMBOLS(OCI_SYM_LOB)
+
     ALLOC_DATA(OCI_IPC_FILE, file, 1)
 
     file->type   = type;
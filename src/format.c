@@ -20,13 +20,34 @@
 
 #include "format.h"
 
+#include "bind.h"
+#include "date.h"
 #include "exception.h"
+#include "hash.h"
 #include "interval.h"
 #include "macros.h"
+#include "memory.h"
+#include "rwlock.h"
 #include "number.h"
 #include "reference.h"
+#include "statement.h"
 #include "timestamp.h"
 
+#define FORMAT_ARG_STRING   1
+#define FORMAT_ARG_DATE     2
+#define FORMAT_ARG_NUMBER   3
+#define FORMAT_ARG_SHORT    4
+#define FORMAT_ARG_USHORT   5
+#define FORMAT_ARG_INT      6
+#define FORMAT_ARG_UINT     7
+#define FORMAT_ARG_BIGINT   8
+#define FORMAT_ARG_BIGUINT  9
+#define FORMAT_ARG_DOUBLE   10
+
+#define FORMAT_BIND_SIZE    12
+
+#define FORMAT_LAST_BIND(stmt) ((stmt)->ubinds[(stmt)->nb_ubinds - 1])
+
 /* --------------------------------------------------------------------------------------------- *
  * ParseSqlFmt
  * --------------------------------------------------------------------------------------------- */
@@ -403,3 +424,511 @@ int FormatParseSql
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatFreeTemplate
+ * --------------------------------------------------------------------------------------------- */
+
+void FormatFreeTemplate
+(
+    OCI_FormatTemplate *tpl
+)
+{
+    if (NULL != tpl)
+    {
+        FREE(tpl->sql)
+        FREE(tpl->args)
+        FREE(tpl)
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatCreateTemplate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_FormatTemplate * FormatCreateTemplate
+(
+    const otext *format
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_FormatTemplate*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_FormatTemplate *tpl = NULL;
+
+    unsigned int max_args = 0;
+    const otext *pf       = format;
+    otext       *ps       = NULL;
+
+    CHECK_PTR(OCI_IPC_STRING, format)
+
+    /* count possible arguments for sizing buffers */
+
+    for (; *pf; pf++)
+    {
+        if (OTEXT('%') == *pf)
+        {
+            max_args++;
+        }
+    }
+
+    ALLOC_DATA(OCI_IPC_FORMAT_TEMPLATE, tpl, 1)
+    ALLOC_DATA(OCI_IPC_STRING, tpl->sql, ostrlen(format) + max_args * FORMAT_BIND_SIZE + 1)
+
+    if (max_args > 0)
+    {
+        ALLOC_DATA(OCI_IPC_INT, tpl->args, max_args)
+    }
+
+    tpl->bindable = TRUE;
+
+    ps = tpl->sql;
+
+    for (pf = format; tpl->bindable && *pf; pf++)
+    {
+        unsigned int arg = 0;
+
+        if (*pf != OTEXT('%'))
+        {
+            *(ps++) = *pf;
+            continue;
+        }
+
+        switch (*(++pf))
+        {
+            case OTEXT('%'):
+            {
+                *(ps++) = *pf;
+                break;
+            }
+            case OTEXT('s'):
+            {
+                arg = FORMAT_ARG_STRING;
+                break;
+            }
+            case OTEXT('t'):
+            {
+                arg = FORMAT_ARG_DATE;
+                break;
+            }
+            case OTEXT('n'):
+            {
+                arg = FORMAT_ARG_NUMBER;
+                break;
+            }
+            case OTEXT('i'):
+            {
+                arg = FORMAT_ARG_INT;
+                break;
+            }
+            case OTEXT('u'):
+            {
+                arg = FORMAT_ARG_UINT;
+                break;
+            }
+            case OTEXT('g'):
+            {
+                arg = FORMAT_ARG_DOUBLE;
+                break;
+            }
+            case OTEXT('l'):
+            {
+                pf++;
+
+                if (OTEXT('i') == *pf)
+                {
+                    arg = FORMAT_ARG_BIGINT;
+                }
+                else if (OTEXT('u') == *pf)
+                {
+                    arg = FORMAT_ARG_BIGUINT;
+                }
+                break;
+            }
+            case OTEXT('h'):
+            {
+                pf++;
+
+                if (OTEXT('i') == *pf)
+                {
+                    arg = FORMAT_ARG_SHORT;
+                }
+                else if (OTEXT('u') == *pf)
+                {
+                    arg = FORMAT_ARG_USHORT;
+                }
+                break;
+            }
+        }
+
+        if (0 != arg)
+        {
+            /* replace the format argument by a bind placeholder */
+
+            tpl->args[tpl->count++] = arg;
+
+            ps += osprintf(ps, FORMAT_BIND_SIZE, OTEXT(":%u"), tpl->count);
+        }
+        else if (OTEXT('%') != *pf)
+        {
+            /* meta data strings, timestamps, intervals, references and invalid
+               tokens are handled by the regular formatting */
+
+            tpl->bindable = FALSE;
+        }
+    }
+
+    if (tpl->count > OCI_BIND_MAX)
+    {
+        tpl->bindable = FALSE;
+    }
+
+    *ps = 0;
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            FormatFreeTemplate(tpl);
+            tpl = NULL;
+        }
+
+        SET_RETVAL(tpl)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatGetTemplate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_FormatTemplate * FormatGetTemplate
+(
+    const otext *format
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_FormatTemplate*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_FormatTemplate *tpl = NULL;
+
+    boolean read_locked  = FALSE;
+    boolean write_locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_STRING, format)
+
+    /* templates are parsed once and kept until the library cleanup, thus
+       lookups only need shared access and the lock is held exclusively on misses.
+       Once the cache is full, templates of new formats are not cached and must be
+       freed by the caller with FormatReleaseTemplate() */
+
+    if (NULL != Env.fmt_lock)
+    {
+        CHECK(RWLockAcquireRead(Env.fmt_lock))
+
+        read_locked = TRUE;
+    }
+
+    if (NULL != Env.fmt_tpls && NULL != HashLookup(Env.fmt_tpls, format, FALSE))
+    {
+        tpl = (OCI_FormatTemplate *) HashGetPointer(Env.fmt_tpls, format);
+    }
+
+    if (read_locked)
+    {
+        read_locked = FALSE;
+
+        CHECK(RWLockReleaseRead(Env.fmt_lock))
+    }
+
+    if (NULL == tpl)
+    {
+        if (NULL != Env.fmt_lock)
+        {
+            CHECK(RWLockAcquireWrite(Env.fmt_lock))
+
+            write_locked = TRUE;
+        }
+
+        if (NULL == Env.fmt_tpls)
+        {
+            Env.fmt_tpls = HashCreate(OCI_HASH_DEFAULT_SIZE, OCI_HASH_POINTER);
+            CHECK_NULL(Env.fmt_tpls)
+        }
+
+        /* another thread may have added the template in the meantime */
+
+        if (NULL != HashLookup(Env.fmt_tpls, format, FALSE))
+        {
+            tpl = (OCI_FormatTemplate *) HashGetPointer(Env.fmt_tpls, format);
+        }
+        else
+        {
+            tpl = FormatCreateTemplate(format);
+            CHECK_NULL(tpl)
+
+            if (Env.fmt_count < OCI_FMT_TEMPLATES_MAX)
+            {
+                if (!HashAddPointer(Env.fmt_tpls, format, tpl))
+                {
+                    FormatFreeTemplate(tpl);
+                    tpl = NULL;
+                }
+                else
+                {
+                    tpl->cached = TRUE;
+
+                    Env.fmt_count++;
+                }
+            }
+        }
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (read_locked)
+        {
+            RWLockReleaseRead(Env.fmt_lock);
+        }
+
+        if (write_locked)
+        {
+            RWLockReleaseWrite(Env.fmt_lock);
+        }
+
+        SET_RETVAL(tpl)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatFreeTemplates
+ * --------------------------------------------------------------------------------------------- */
+
+void FormatFreeTemplates
+(
+    void
+)
+{
+    OCI_HashEntry *e = NULL;
+    OCI_HashValue *v = NULL;
+
+    unsigned int count = 0;
+
+    if (NULL == Env.fmt_tpls)
+    {
+        return;
+    }
+
+    count = HashGetSize(Env.fmt_tpls);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        e = HashGetEntry(Env.fmt_tpls, i);
+
+        while (e)
+        {
+            v = e->values;
+
+            while (v)
+            {
+                FormatFreeTemplate((OCI_FormatTemplate *) (v->value.p_void));
+
+                v = v->next;
+            }
+
+            e = e->next;
+        }
+    }
+
+    HashFree(Env.fmt_tpls);
+
+    Env.fmt_tpls  = NULL;
+    Env.fmt_count = 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatReleaseTemplate
+ * --------------------------------------------------------------------------------------------- */
+
+void FormatReleaseTemplate
+(
+    OCI_FormatTemplate *tpl
+)
+{
+    /* cached templates are freed at cleanup by FormatFreeTemplates() */
+
+    if (NULL != tpl && !tpl->cached)
+    {
+        FormatFreeTemplate(tpl);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatBindArguments
+ * --------------------------------------------------------------------------------------------- */
+
+boolean FormatBindArguments
+(
+    OCI_Statement      *stmt,
+    OCI_FormatTemplate *tpl,
+    va_list            *pargs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    const unsigned int alloc_mode = stmt ? stmt->bind_alloc_mode : OCI_BAM_EXTERNAL;
+
+    CHECK_PTR(OCI_IPC_STATEMENT,       stmt)
+    CHECK_PTR(OCI_IPC_FORMAT_TEMPLATE, tpl)
+
+    /* format arguments values are copied into internally allocated binds */
+
+    stmt->bind_alloc_mode = OCI_BAM_INTERNAL;
+
+    for (unsigned int i = 0; i < tpl->count; i++)
+    {
+        otext name[FORMAT_BIND_SIZE];
+
+        osprintf(name, FORMAT_BIND_SIZE, OTEXT(":%u"), i + 1);
+
+        switch (tpl->args[i])
+        {
+            case FORMAT_ARG_STRING:
+            {
+                const otext *str = (const otext *) va_arg(*pargs, const otext *);
+
+                const unsigned int len = IS_STRING_VALID(str) ? (unsigned int) ostrlen(str) : 0;
+
+                /* internal buffer must be able to hold the otext string and its dbtext conversion */
+
+                CHECK(StatementBindString(stmt, name, NULL, (len + 1) * (unsigned int) (sizeof(otext) / sizeof(dbtext))))
+
+                if (NULL != str)
+                {
+                    ostrcpy((otext *) FORMAT_LAST_BIND(stmt)->input, str);
+                }
+                else
+                {
+                    CHECK(BindSetNull(FORMAT_LAST_BIND(stmt)))
+                }
+                break;
+            }
+            case FORMAT_ARG_DATE:
+            {
+                OCI_Date *date = (OCI_Date *) va_arg(*pargs, OCI_Date *);
+
+                CHECK(StatementBindDate(stmt, name, NULL))
+
+                if (NULL != date)
+                {
+                    CHECK(DateAssign((OCI_Date *) FORMAT_LAST_BIND(stmt)->input, date))
+                }
+                else
+                {
+                    CHECK(BindSetNull(FORMAT_LAST_BIND(stmt)))
+                }
+                break;
+            }
+            case FORMAT_ARG_NUMBER:
+            {
+                OCI_Number *number = (OCI_Number *) va_arg(*pargs, OCI_Number *);
+
+                CHECK(StatementBindNumber(stmt, name, NULL))
+
+                if (NULL != number)
+                {
+                    CHECK(NumberAssign((OCI_Number *) FORMAT_LAST_BIND(stmt)->input, number))
+                }
+                else
+                {
+                    CHECK(BindSetNull(FORMAT_LAST_BIND(stmt)))
+                }
+                break;
+            }
+            case FORMAT_ARG_SHORT:
+            {
+                /* short int must be passed as int to va_args */
+
+                const short value = (short) va_arg(*pargs, int);
+
+                CHECK(StatementBindShort(stmt, name, NULL))
+
+                *((short *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+            case FORMAT_ARG_USHORT:
+            {
+                const unsigned short value = (unsigned short) va_arg(*pargs, unsigned int);
+
+                CHECK(StatementBindUnsignedShort(stmt, name, NULL))
+
+                *((unsigned short *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+            case FORMAT_ARG_INT:
+            {
+                const int value = va_arg(*pargs, int);
+
+                CHECK(StatementBindInt(stmt, name, NULL))
+
+                *((int *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+            case FORMAT_ARG_UINT:
+            {
+                const unsigned int value = va_arg(*pargs, unsigned int);
+
+                CHECK(StatementBindUnsignedInt(stmt, name, NULL))
+
+                *((unsigned int *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+            case FORMAT_ARG_BIGINT:
+            {
+                const big_int value = va_arg(*pargs, big_int);
+
+                CHECK(StatementBindBigInt(stmt, name, NULL))
+
+                *((big_int *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+            case FORMAT_ARG_BIGUINT:
+            {
+                const big_uint value = va_arg(*pargs, big_uint);
+
+                CHECK(StatementBindUnsignedBigInt(stmt, name, NULL))
+
+                *((big_uint *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+            case FORMAT_ARG_DOUBLE:
+            {
+                const double value = va_arg(*pargs, double);
+
+                CHECK(StatementBindDouble(stmt, name, NULL))
+
+                *((double *) FORMAT_LAST_BIND(stmt)->input) = value;
+                break;
+            }
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != stmt)
+        {
+            stmt->bind_alloc_mode = alloc_mode;
+        }
+    )
+}
@@ -31,4 +31,36 @@ int FormatParseSql
     va_list      * pargs
 );
 
+void FormatFreeTemplate
+(
+    OCI_FormatTemplate* tpl
+);
+
+OCI_FormatTemplate* FormatCreateTemplate
+(
+    const otext* format
+);
+
+OCI_FormatTemplate* FormatGetTemplate
+(
+    const otext* format
+);
+
+void FormatReleaseTemplate
+(
+    OCI_FormatTemplate* tpl
+);
+
+void FormatFreeTemplates
+(
+    void
+);
+
+boolean FormatBindArguments
+(
+    OCI_Statement     * stmt,
+    OCI_FormatTemplate* tpl,
+    va_list           * pargs
+);
+
 #endif /* OCILIB_FORMAT_H_INCLUDED */
@@ -30,6 +30,12 @@
 #include "reference.h"
 #include "timestamp.h"
 
+#if defined(_WINDOWS)
+  #include <windows.h>
+#elif !defined(CLOCK_MONOTONIC)
+  #include <sys/time.h>
+#endif
+
 /* --------------------------------------------------------------------------------------------- *
   * ExternalSubTypeToSQLType
   * --------------------------------------------------------------------------------------------- */
@@ -229,3 +235,73 @@ boolean FreeObjectFromType
 
     return res;
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * ClockGetMicroseconds
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint ClockGetMicroseconds
+(
+    void
+)
+{
+    big_uint res = 0;
+
+#if defined(_WINDOWS)
+
+    LARGE_INTEGER freq;
+    LARGE_INTEGER counter;
+
+    if (QueryPerformanceFrequency(&freq) && QueryPerformanceCounter(&counter) && freq.QuadPart > 0)
+    {
+        res = (big_uint) (counter.QuadPart / freq.QuadPart) * 1000000 +
+              (big_uint) (counter.QuadPart % freq.QuadPart) * 1000000 / (big_uint) freq.QuadPart;
+    }
+
+#elif defined(CLOCK_MONOTONIC)
+
+    struct timespec ts;
+
+    if (0 == clock_gettime(CLOCK_MONOTONIC, &ts))
+    {
+        res = (big_uint) ts.tv_sec * 1000000 + (big_uint) ts.tv_nsec / 1000;
+    }
+
+#else
+
+    struct timeval tv;
+
+    if (0 == gettimeofday(&tv, NULL))
+    {
+        res = (big_uint) tv.tv_sec * 1000000 + (big_uint) tv.tv_usec;
+    }
+
+#endif
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ClockSleepMilliseconds
+ * --------------------------------------------------------------------------------------------- */
+
+void ClockSleepMilliseconds
+(
+    unsigned int value
+)
+{
+#if defined(_WINDOWS)
+
+    Sleep((DWORD) value);
+
+#else
+
+    struct timespec ts;
+
+    ts.tv_sec  = (time_t) (value / 1000);
+    ts.tv_nsec = (long) (value % 1000) * 1000000;
+
+    nanosleep(&ts, NULL);
+
+#endif
+}
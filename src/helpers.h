@@ -41,4 +41,14 @@ boolean FreeObjectFromType
     unsigned int type
 );
 
+big_uint ClockGetMicroseconds
+(
+    void
+);
+
+void ClockSleepMilliseconds
+(
+    unsigned int value
+);
+
 #endif /* OCILIB_HELPERS_H_INCLUDED */
@@ -299,6 +299,7 @@ extern OCILOBREAD2         OCILobRead2;
 extern OCILOBTRIM2         OCILobTrim2;
 extern OCILOBWRITE2        OCILobWrite2;
 extern OCILOBWRITEAPPEND2  OCILobWriteAppend2;
+extern OCILOBARRAYWRITE    OCILobArrayWrite;
 
     #endif
 
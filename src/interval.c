@@ -21,6 +21,7 @@
 #include "interval.h"
 
 #include "array.h"
+#include "connection.h"
 #include "helpers.h"
 #include "macros.h"
 #include "strings.h"
@@ -55,6 +56,8 @@ OCI_Interval * IntervalInitialize
 
 #if OCI_VERSION_COMPILE >= OCI_9_0
 
+    CHECK_SYMBOLS(OCI_SYM_INTERVAL)
+
     ALLOC_DATA(OCI_IPC_INTERVAL, itv, 1);
 
     itv->con    = con;
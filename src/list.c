@@ -22,35 +22,51 @@
 
 #include "macros.h"
 #include "memory.h"
-#include "mutex.h"
+#include "rwlock.h"
 
-#define ACQUIRE_LOCK()                   \
-                                         \
-    if (NULL != list->mutex)             \
-    {                                    \
-        CHECK(MutexAcquire(list->mutex)) \
+#define ACQUIRE_READ_LOCK()                   \
+                                              \
+    if (NULL != list->lock)                   \
+    {                                         \
+        CHECK(RWLockAcquireRead(list->lock))  \
     }
 
-#define RELEASE_LOCK()                   \
-                                         \
-    if (NULL != list->mutex)             \
-    {                                    \
-        CHECK(MutexRelease(list->mutex)) \
+#define RELEASE_READ_LOCK()                   \
+                                              \
+    if (NULL != list->lock)                   \
+    {                                         \
+        CHECK(RWLockReleaseRead(list->lock))  \
     }
 
+#define ACQUIRE_WRITE_LOCK()                  \
+                                              \
+    if (NULL != list->lock)                   \
+    {                                         \
+        CHECK(RWLockAcquireWrite(list->lock)) \
+    }
+
+#define RELEASE_WRITE_LOCK()                  \
+                                              \
+    if (NULL != list->lock)                   \
+    {                                         \
+        CHECK(RWLockReleaseWrite(list->lock)) \
+    }
+
+/* walks are only reading the list, thus several threads can iterate concurrently */
+
 #define LIST_FOR_EACH(exp)     \
                                \
     if (list)                  \
     {                          \
         OCI_Item *item = NULL; \
-        ACQUIRE_LOCK()         \
+        ACQUIRE_READ_LOCK()    \
         item = list->head;     \
         while (item)           \
         {                      \
             exp;               \
             item = item->next; \
         }                      \
-        RELEASE_LOCK()         \
+        RELEASE_READ_LOCK()    \
     }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -130,13 +146,14 @@ OCI_List* ListCreate
 
     CHECK_NULL(list)
 
-    /* create a mutex on multi threaded environments */
+    /* create a lock on multi threaded environments */
 
     list->type = type;
 
     if (LIB_THREADED)
     {
-        list->mutex = MutexCreateInternal();
+        list->lock = RWLockCreateInternal();
+        CHECK_NULL(list->lock)
     }
 
     CLEANUP_AND_EXIT_FUNC
@@ -169,9 +186,9 @@ boolean ListFree
 
     ListClear(list);
 
-    if (NULL!= list->mutex)
+    if (NULL != list->lock)
     {
-        MutexFree(list->mutex);
+        RWLockFree(list->lock);
     }
 
     ErrorResetSource(NULL, list);
@@ -207,7 +224,7 @@ void * ListAppend
     item = ListCreateItem(list->type, size);
     CHECK_NULL(item)
 
-    ACQUIRE_LOCK()
+    ACQUIRE_WRITE_LOCK()
 
     temp = list->head;
 
@@ -227,7 +244,7 @@ void * ListAppend
 
     list->count++;
 
-    RELEASE_LOCK()
+    RELEASE_WRITE_LOCK()
 
     SET_RETVAL(item->data)
 
@@ -253,7 +270,7 @@ boolean ListClear
 
     CHECK_PTR(OCI_IPC_LIST, list)
 
-    ACQUIRE_LOCK()
+    ACQUIRE_WRITE_LOCK()
 
     /* walk along the list to free item's buffer */
 
@@ -274,7 +291,7 @@ boolean ListClear
     list->head  = NULL;
     list->count = 0;
 
-    RELEASE_LOCK()
+    RELEASE_WRITE_LOCK()
 
     SET_SUCCESS()
 
@@ -356,7 +373,7 @@ boolean ListRemove
     CHECK_PTR(OCI_IPC_LIST, list)
     CHECK_PTR(OCI_IPC_VOID, data)
 
-    ACQUIRE_LOCK()
+    ACQUIRE_WRITE_LOCK()
 
     item = list->head;
 
@@ -395,7 +412,7 @@ boolean ListRemove
         list->count--;
     }
 
-    RELEASE_LOCK()
+    RELEASE_WRITE_LOCK()
 
     SET_RETVAL(found)
 
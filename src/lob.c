@@ -22,9 +22,24 @@
 
 #include "array.h"
 #include "connection.h"
+#include "error.h"
 #include "macros.h"
 #include "memory.h"
+#include "mutex.h"
+#include "pool.h"
+#include "resultset.h"
+#include "statement.h"
 #include "strings.h"
+#include "thread.h"
+
+#if defined(_WINDOWS)
+  #include <windows.h>
+#else
+  #include <errno.h>
+  #include <fcntl.h>
+  #include <limits.h>
+  #include <unistd.h>
+#endif
 
 static const unsigned int SeekModeValues[] =
 {
@@ -46,6 +61,33 @@ static const unsigned int LobTypeValues[] =
     OCI_BLOB
 };
 
+/* state shared by the threads of a parallel lob download, kept private
+   to this module to avoid spreading system headers */
+
+typedef struct OCI_LobDownload
+{
+    OCI_Pool          *pool;      /* pool providing the worker sessions */
+    const otext       *sql;       /* query selecting the lob */
+    const otext       *filename;  /* destination file name */
+    POCI_LOB_PROGRESS  handler;   /* progress callback (optional) */
+    void              *ctx;       /* progress callback context */
+    OCI_Mutex         *mutex;     /* protects the fields below */
+    big_uint           size;      /* lob size */
+    big_uint           seg_size;  /* size of the ranges handed to workers */
+    big_uint           next;      /* offset of the next range to download */
+    big_uint           done;      /* number of bytes written */
+    big_uint           reported;  /* number of bytes last reported to the callback */
+    boolean            reporting; /* a worker is calling the progress callback */
+    unsigned int       buf_size;  /* size of the worker read buffers */
+    int                code;      /* error code of the first failing worker */
+    boolean            failed;    /* a worker has failed */
+#if defined(_WINDOWS)
+    HANDLE             file;      /* destination file handle */
+#else
+    int                fd;        /* destination file descriptor */
+#endif
+} OCI_LobDownload;
+
 /* --------------------------------------------------------------------------------------------- *
  * LobInit
  * --------------------------------------------------------------------------------------------- */
@@ -64,6 +106,8 @@ OCI_Lob * LobInitialize
         /* context */ OCI_IPC_LOB, lob
     )
 
+    CHECK_SYMBOLS(OCI_SYM_LOB)
+
     ALLOC_DATA(OCI_IPC_LOB, lob, 1);
 
     lob->type   = type;
@@ -157,20 +201,110 @@ OCI_Lob * LobCreate
         /* context */ OCI_IPC_CONNECTION, con
     )
 
+    OCI_Lob *lob = NULL;
+
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
     CHECK_ENUM_VALUE(type, LobTypeValues, OTEXT("Lob type"))
 
-    SET_RETVAL(LobInitialize(con, NULL, NULL, type))
+    /* look for a recycled temporary lob of the same type, most recently freed first */
+
+    for (unsigned int i = con->tmp_count; i > 0; i--)
+    {
+        if (con->tmp_lobs[i - 1]->type == type)
+        {
+            lob = con->tmp_lobs[i - 1];
+
+            /* checked out lobs are removed from the cache */
+
+            con->tmp_count--;
+
+            memmove(&con->tmp_lobs[i - 1], &con->tmp_lobs[i],
+                    (size_t) (con->tmp_count - (i - 1)) * sizeof(*con->tmp_lobs));
+
+            con->tmp_lobs[con->tmp_count] = NULL;
+
+            break;
+        }
+    }
+
+    if (NULL != lob)
+    {
+        con->tmp_hits++;
+    }
+    else
+    {
+        con->tmp_misses++;
+
+        lob = LobInitialize(con, NULL, NULL, type);
+    }
+
+    SET_RETVAL(lob)
 
     EXIT_FUNC()
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * LobFree
+ * LobRecycle
  * --------------------------------------------------------------------------------------------- */
 
-boolean LobFree
+static boolean LobRecycle
+(
+    OCI_Lob *lob
+)
+{
+    OCI_Connection *con     = lob->con;
+    sword           ret     = OCI_ERROR;
+    boolean         is_temp = FALSE;
+
+    /* only standalone temporary lobs can be kept in the connection cache */
+
+    if (OCI_OBJECT_ALLOCATED != lob->hstate || NULL == con ||
+        NULL == con->tmp_lobs || con->tmp_count >= con->tmp_size)
+    {
+        return FALSE;
+    }
+
+    if (OCI_SUCCESS != OCILobIsTemporary(con->env, con->err, lob->handle, &is_temp) || !is_temp)
+    {
+        return FALSE;
+    }
+
+    /* the lob is emptied with a single trim, failures falling back to a regular free */
+
+#ifdef OCI_LOB2_API_ENABLED
+
+    if (Env.use_lob_ub8)
+    {
+        ret = OCILobTrim2(con->cxt, con->err, lob->handle, (ub8) 0);
+    }
+    else
+
+#endif
+
+    {
+        ret = OCILobTrim(con->cxt, con->err, lob->handle, (ub4) 0);
+    }
+
+    if (OCI_SUCCESS != ret)
+    {
+        return FALSE;
+    }
+
+    lob->offset = 1;
+
+    ErrorResetSource(NULL, lob);
+
+    con->tmp_lobs[con->tmp_count++] = lob;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobDispose
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean LobDispose
 (
     OCI_Lob *lob
 )
@@ -182,7 +316,6 @@ boolean LobFree
     )
 
     CHECK_PTR(OCI_IPC_LOB, lob)
-    CHECK_OBJECT_FETCHED(lob)
 
     if (LobIsTemporary(lob))
     {
@@ -212,6 +345,75 @@ boolean LobFree
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * LobFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobFree
+(
+    OCI_Lob *lob
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, lob
+    )
+
+    CHECK_PTR(OCI_IPC_LOB, lob)
+    CHECK_OBJECT_FETCHED(lob)
+
+    /* temporary lobs are kept for reuse when the connection cache has room left */
+
+    if (!LobRecycle(lob))
+    {
+        CHECK(LobDispose(lob))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobShrinkCache
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobShrinkCache
+(
+    OCI_Connection *con,
+    unsigned int    size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    boolean res = TRUE;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* free the temporary lobs that do not fit anymore, going on with the
+       remaining ones when one of them cannot be disposed */
+
+    while (con->tmp_count > size)
+    {
+        OCI_Lob *lob = con->tmp_lobs[--con->tmp_count];
+
+        con->tmp_lobs[con->tmp_count] = NULL;
+
+        res = LobDispose(lob) && res;
+    }
+
+    CHECK(res)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * LobCreateArray
  * --------------------------------------------------------------------------------------------- */
@@ -718,6 +920,238 @@ unsigned int LobWrite
     return (NULL != ptr_count ? *ptr_count : 0);
 }
 
+#ifdef OCI_LOB2_API_ENABLED
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobGetUTF8Size
+ * --------------------------------------------------------------------------------------------- */
+
+static size_t LobGetUTF8Size
+(
+    const char  *str,
+    unsigned int nb_chars
+)
+{
+    /* number of bytes of the given number of UTF8 characters, the length of each
+       character being given by its lead byte so that no byte past it is read */
+
+    const unsigned char *ptr = (const unsigned char *) str;
+
+    size_t size = 0;
+
+    for (; nb_chars > 0; nb_chars--)
+    {
+        const unsigned char lead = ptr[size];
+
+        if (0xF0 == (lead & 0xF8))
+        {
+            size += 4;
+        }
+        else if (0xE0 == (lead & 0xF0))
+        {
+            size += 3;
+        }
+        else if (0xC0 == (lead & 0xE0))
+        {
+            size += 2;
+        }
+        else
+        {
+            size += 1;
+        }
+    }
+
+    return size;
+}
+
+#endif
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobArrayWrite
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobArrayWrite
+(
+    OCI_Lob     **lobs,
+    unsigned int  count,
+    void        **buffers,
+    unsigned int *sizes
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_Connection *con   = NULL;
+    OCILobLocator **locs  = NULL;
+    ub8            *bytes = NULL;
+    ub8            *chars = NULL;
+    ub8            *offs  = NULL;
+    ub8            *lens  = NULL;
+    void          **bufs  = NULL;
+    unsigned int   *idx   = NULL;
+
+    unsigned int nb_writes = 0;
+
+    ub4 type  = OCI_UNKNOWN;
+    ub1 csfrm = 0;
+    ub2 csid  = 0;
+
+    CHECK_PTR(OCI_IPC_ARRAY, lobs)
+    CHECK_PTR(OCI_IPC_BUFF_ARRAY, buffers)
+    CHECK_PTR(OCI_IPC_INT, sizes)
+    CHECK_MIN(count, 1)
+
+    CHECK_PTR(OCI_IPC_LOB, lobs[0])
+
+    con  = lobs[0]->con;
+    type = lobs[0]->type;
+
+    CHECK_FEATURE(con, OCI_FEATURE_LOB_ARRAY_WRITE, OCI_11_1)
+
+#ifdef OCI_LOB2_API_ENABLED
+
+    ALLOC_DATA(OCI_IPC_ARRAY, locs, count)
+    ALLOC_DATA(OCI_IPC_ARRAY, bytes, count)
+    ALLOC_DATA(OCI_IPC_ARRAY, chars, count)
+    ALLOC_DATA(OCI_IPC_ARRAY, offs, count)
+    ALLOC_DATA(OCI_IPC_ARRAY, lens, count)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, bufs, count)
+    ALLOC_DATA(OCI_IPC_ARRAY, idx, count)
+
+    if (OCI_BLOB != type && OCI_CHAR_WIDE == Env.charset)
+    {
+        csid = OCI_UTF16ID;
+    }
+
+    csfrm = (OCI_NCLOB == type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
+
+    /* all locators are written in a single call : they must share the connection and the
+       character set form. As with LobWrite(), empty buffers are not written */
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        OCI_Lob *lob = lobs[i];
+
+        CHECK_PTR(OCI_IPC_LOB, lob)
+        CHECK_COMPAT(lob->con == con && lob->type == type)
+
+        if (0 == sizes[i])
+        {
+            continue;
+        }
+
+        CHECK_PTR(OCI_IPC_BUFF_ARRAY, buffers[i])
+
+        locs[nb_writes] = lob->handle;
+        offs[nb_writes] = (ub8) lob->offset;
+        idx[nb_writes]  = i;
+
+        if (OCI_BLOB == type)
+        {
+            bytes[nb_writes] = (ub8) sizes[i];
+            bufs[nb_writes]  = buffers[i];
+        }
+        else
+        {
+            int size = 0;
+
+            if (Env.nls_utf8)
+            {
+                /* the amount is given in characters, the buffer being possibly not null terminated */
+
+                size = (int) LobGetUTF8Size((const char *) buffers[i], sizes[i]);
+            }
+            else
+            {
+                size = (int) (sizes[i] * (unsigned int) sizeof(otext));
+
+                chars[nb_writes] = (ub8) sizes[i];
+            }
+
+            bufs[nb_writes]  = StringGetDBString((otext *) buffers[i], &size);
+            bytes[nb_writes] = (ub8) size;
+
+            CHECK_NULL(bufs[nb_writes])
+        }
+
+        lens[nb_writes] = bytes[nb_writes];
+
+        nb_writes++;
+    }
+
+    if (nb_writes > 0)
+    {
+        ub4 iter = (ub4) nb_writes;
+
+        CHECK_OCI
+        (
+            con->err,
+            OCILobArrayWrite,
+            con->cxt, con->err, &iter, locs, bytes, chars, offs,
+            bufs, lens, (ub1) OCI_ONE_PIECE, (void *) NULL,
+            NULL, csid, csfrm
+        )
+    }
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        sizes[i] = 0;
+    }
+
+    for (unsigned int i = 0; i < nb_writes; i++)
+    {
+        const unsigned int k = idx[i];
+
+        sizes[k] = (unsigned int) (OCI_BLOB == type ? bytes[i] : chars[i]);
+
+        lobs[k]->offset += (big_uint) sizes[k];
+    }
+
+    SET_SUCCESS()
+
+#else
+
+    OCI_NOT_USED(locs)
+    OCI_NOT_USED(bytes)
+    OCI_NOT_USED(chars)
+    OCI_NOT_USED(offs)
+    OCI_NOT_USED(lens)
+    OCI_NOT_USED(bufs)
+    OCI_NOT_USED(idx)
+    OCI_NOT_USED(nb_writes)
+    OCI_NOT_USED(csfrm)
+    OCI_NOT_USED(csid)
+
+    THROW(ExceptionNotAvailable, OCI_FEATURE_LOB_ARRAY_WRITE)
+
+#endif
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != bufs && NULL != idx)
+        {
+            for (unsigned int i = 0; i < nb_writes; i++)
+            {
+                if (NULL != bufs[i] && bufs[i] != buffers[idx[i]])
+                {
+                    StringReleaseDBString((dbtext *) bufs[i]);
+                }
+            }
+        }
+
+        FREE(locs)
+        FREE(bytes)
+        FREE(chars)
+        FREE(offs)
+        FREE(lens)
+        FREE(bufs)
+        FREE(idx)
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * LobTruncate
  * --------------------------------------------------------------------------------------------- */
@@ -1609,3 +2043,525 @@ boolean LobIsRemote
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobDownloadOpenFile
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean LobDownloadOpenFile
+(
+    OCI_LobDownload *dl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    boolean res = FALSE;
+
+#if defined(_WINDOWS)
+
+  #if defined(OCI_CHARSET_WIDE)
+    dl->file = CreateFileW(dl->filename, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_NORMAL, NULL);
+  #else
+    dl->file = CreateFileA(dl->filename, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_NORMAL, NULL);
+  #endif
+
+    res = (INVALID_HANDLE_VALUE != dl->file);
+
+#else
+
+  #if defined(OCI_CHARSET_WIDE)
+
+    char *name = NULL;
+    size_t len = ostrlen(dl->filename) * MB_LEN_MAX + 1;
+
+    ALLOC_DATA(OCI_IPC_STRING, name, len)
+
+    if ((size_t) -1 != wcstombs(name, dl->filename, len))
+    {
+        dl->fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+
+    FREE(name)
+
+  #else
+
+    dl->fd = open(dl->filename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+  #endif
+
+    res = (dl->fd >= 0);
+
+#endif
+
+    if (!res)
+    {
+        THROW(ExceptionFileAccess, dl->filename)
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobDownloadCloseFile
+ * --------------------------------------------------------------------------------------------- */
+
+static void LobDownloadCloseFile
+(
+    OCI_LobDownload *dl
+)
+{
+#if defined(_WINDOWS)
+
+    if (INVALID_HANDLE_VALUE != dl->file)
+    {
+        CloseHandle(dl->file);
+    }
+
+#else
+
+    if (dl->fd >= 0)
+    {
+        close(dl->fd);
+    }
+
+#endif
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobDownloadWriteFile
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean LobDownloadWriteFile
+(
+    OCI_LobDownload *dl,
+    const ub1       *buffer,
+    unsigned int     size,
+    big_uint         offset
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    /* positioned writes allow workers to share the file without seeking */
+
+    while (size > 0)
+    {
+#if defined(_WINDOWS)
+
+        OVERLAPPED ov;
+        DWORD      count = 0;
+
+        memset(&ov, 0, sizeof(ov));
+
+        ov.Offset     = (DWORD) (offset & 0xFFFFFFFF);
+        ov.OffsetHigh = (DWORD) (offset >> 32);
+
+        if (!WriteFile(dl->file, buffer, (DWORD) size, &count, &ov) || 0 == count)
+        {
+            THROW(ExceptionFileAccess, dl->filename)
+        }
+
+#else
+
+        const ssize_t count = pwrite(dl->fd, buffer, (size_t) size, (off_t) offset);
+
+        if (count < 0 && EINTR == errno)
+        {
+            continue;
+        }
+
+        if (count <= 0)
+        {
+            THROW(ExceptionFileAccess, dl->filename)
+        }
+
+#endif
+
+        buffer += count;
+        offset += (big_uint) count;
+        size   -= (unsigned int) count;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobDownloadProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void LobDownloadProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_LobDownload *dl   = (OCI_LobDownload *) arg;
+    OCI_Connection  *con  = NULL;
+    OCI_Statement   *stmt = NULL;
+    OCI_Resultset   *rs   = NULL;
+    OCI_Lob         *lob  = NULL;
+    ub1             *buf  = NULL;
+
+    boolean res = FALSE;
+
+    /* a lob locator is bound to the session it was selected from, thus each
+       worker selects the lob again from its own pooled session */
+
+    con = PoolGetConnection(dl->pool, NULL);
+
+    if (NULL != con)
+    {
+        stmt = StatementCreate(con);
+    }
+
+    if (NULL != stmt && StatementExecuteStmt(stmt, dl->sql))
+    {
+        rs = StatementGetResultset(stmt);
+    }
+
+    if (NULL != rs && ResultsetFetchNext(rs))
+    {
+        lob = ResultsetGetLob(rs, 1);
+        buf = (ub1 *) MemoryAlloc(OCI_IPC_BUFF_ARRAY, sizeof(*buf), (size_t) dl->buf_size, FALSE);
+    }
+
+    res = (NULL != lob && NULL != buf);
+
+    while (res)
+    {
+        big_uint offset = 0;
+        big_uint end    = 0;
+        boolean  stop   = FALSE;
+
+        if (NULL != dl->mutex)
+        {
+            MutexAcquire(dl->mutex);
+        }
+
+        offset    = dl->next;
+        dl->next += dl->seg_size;
+        stop      = dl->failed;
+
+        if (NULL != dl->mutex)
+        {
+            MutexRelease(dl->mutex);
+        }
+
+        if (offset >= dl->size || stop)
+        {
+            break;
+        }
+
+        end = offset + dl->seg_size < dl->size ? offset + dl->seg_size : dl->size;
+
+        /* the range is known to be within the lob, no need for LobSeek() size check */
+
+        lob->offset = offset + 1;
+
+        while (res && offset < end)
+        {
+            const unsigned int count = (unsigned int) (end - offset < dl->buf_size ? end - offset : dl->buf_size);
+
+            res = (count == LobRead(lob, buf, count)) &&
+                  LobDownloadWriteFile(dl, buf, count, offset);
+
+            if (res)
+            {
+                big_uint done   = 0;
+                boolean  report = FALSE;
+
+                offset += count;
+
+                if (NULL != dl->mutex)
+                {
+                    MutexAcquire(dl->mutex);
+                }
+
+                dl->done += count;
+
+                /* the callback is called outside of the lock, by one worker at a time
+                   that also reports the progress made by the others meanwhile */
+
+                if (NULL != dl->handler && !dl->reporting)
+                {
+                    dl->reporting = TRUE;
+                    report        = TRUE;
+                }
+
+                while (report)
+                {
+                    done         = dl->done;
+                    dl->reported = done;
+
+                    if (NULL != dl->mutex)
+                    {
+                        MutexRelease(dl->mutex);
+                    }
+
+                    dl->handler(dl->ctx, done, dl->size);
+
+                    if (NULL != dl->mutex)
+                    {
+                        MutexAcquire(dl->mutex);
+                    }
+
+                    if (dl->reported == dl->done)
+                    {
+                        dl->reporting = FALSE;
+                        report        = FALSE;
+                    }
+                }
+
+                if (NULL != dl->mutex)
+                {
+                    MutexRelease(dl->mutex);
+                }
+            }
+        }
+    }
+
+    if (!res)
+    {
+        /* when running in a worker thread, the error is reported to the caller
+           through the download state and then cleared */
+
+        OCI_Error *err = ErrorGet(FALSE, FALSE);
+
+        if (NULL != dl->mutex)
+        {
+            MutexAcquire(dl->mutex);
+        }
+
+        if (!dl->failed)
+        {
+            dl->failed = TRUE;
+            dl->code   = (NULL != err && 0 != err->code) ? err->code : -1;
+        }
+
+        if (NULL != dl->mutex)
+        {
+            MutexRelease(dl->mutex);
+        }
+
+        if (NULL != thread)
+        {
+            ErrorReset(err);
+        }
+    }
+
+    if (NULL != buf)
+    {
+        MemoryFree(buf);
+    }
+
+    if (NULL != stmt)
+    {
+        StatementFree(stmt);
+    }
+
+    if (NULL != con)
+    {
+        ConnectionFree(con);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobDownload
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobDownload
+(
+    OCI_Pool          *pool,
+    const otext       *sql,
+    const otext       *filename,
+    unsigned int       nb_workers,
+    POCI_LOB_PROGRESS  handler,
+    void              *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    OCI_LobDownload dl;
+    OCI_Connection *con     = NULL;
+    OCI_Statement  *stmt    = NULL;
+    OCI_Resultset  *rs      = NULL;
+    OCI_Lob        *lob     = NULL;
+    OCI_Thread    **threads = NULL;
+
+    unsigned int nb_threads = 0;
+    unsigned int nb_started = 0;
+    unsigned int chunk_size = 0;
+    big_uint     nb_segs    = 0;
+
+    memset(&dl, 0, sizeof(dl));
+
+#if defined(_WINDOWS)
+    dl.file = INVALID_HANDLE_VALUE;
+#else
+    dl.fd = -1;
+#endif
+
+    CHECK_PTR(OCI_IPC_POOL,   pool)
+    CHECK_PTR(OCI_IPC_STRING, sql)
+    CHECK_PTR(OCI_IPC_STRING, filename)
+    CHECK_MIN(nb_workers, 1)
+
+    dl.pool     = pool;
+    dl.sql      = sql;
+    dl.filename = filename;
+    dl.handler  = handler;
+    dl.ctx      = ctx;
+
+    /* select the lob a first time to get its size and chunk size */
+
+    con = PoolGetConnection(pool, NULL);
+    CHECK_NULL(con)
+
+    stmt = StatementCreate(con);
+    CHECK_NULL(stmt)
+
+    CHECK(StatementExecuteStmt(stmt, sql))
+
+    rs = StatementGetResultset(stmt);
+    CHECK_NULL(rs)
+
+    CHECK(ResultsetFetchNext(rs))
+
+    lob = ResultsetGetLob(rs, 1);
+    CHECK_NULL(lob)
+
+    /* character lob offsets do not match file offsets with variable width charsets */
+
+    CHECK_COMPAT(OCI_BLOB == lob->type)
+
+    dl.size    = LobGetLength(lob);
+    chunk_size = LobGetChunkSize(lob);
+
+    CHECK(StatementFree(stmt))
+    stmt = NULL;
+
+    CHECK(ConnectionFree(con))
+    con = NULL;
+
+    /* ranges and reads are aligned on the lob chunk size */
+
+    if (0 == chunk_size)
+    {
+        chunk_size = OCI_SIZE_BUFFER;
+    }
+
+    dl.buf_size = chunk_size * (OCI_LOB_DOWNLOAD_BUFFER_SIZE / chunk_size > 0 ? OCI_LOB_DOWNLOAD_BUFFER_SIZE / chunk_size : 1);
+    dl.seg_size = (big_uint) dl.buf_size * (OCI_LOB_DOWNLOAD_SEGMENT_SIZE / dl.buf_size > 0 ? OCI_LOB_DOWNLOAD_SEGMENT_SIZE / dl.buf_size : 1);
+
+    CHECK(LobDownloadOpenFile(&dl))
+
+    nb_segs = (dl.size + dl.seg_size - 1) / dl.seg_size;
+
+    nb_threads = nb_workers;
+
+    if ((big_uint) nb_threads > nb_segs)
+    {
+        nb_threads = (unsigned int) nb_segs;
+    }
+
+    if (nb_threads > PoolGetMax(pool))
+    {
+        nb_threads = PoolGetMax(pool);
+    }
+
+    if (LIB_THREADED && nb_threads > 1)
+    {
+        /* ranges are handed to a bounded set of worker threads, each thread
+           downloading ranges until the whole lob has been processed */
+
+        dl.mutex = MutexCreateInternal();
+        CHECK_NULL(dl.mutex)
+
+        ALLOC_DATA(OCI_IPC_ARRAY, threads, nb_threads)
+
+        for (nb_started = 0; nb_started < nb_threads; nb_started++)
+        {
+            threads[nb_started] = ThreadCreate();
+            CHECK_NULL(threads[nb_started])
+
+            if (!ThreadRun(threads[nb_started], LobDownloadProc, &dl))
+            {
+                ThreadFree(threads[nb_started]);
+                threads[nb_started] = NULL;
+
+                CHECK(FALSE)
+            }
+        }
+
+        for (unsigned int i = 0; i < nb_started; i++)
+        {
+            CHECK(ThreadJoin(threads[i]))
+            CHECK(ThreadFree(threads[i]))
+
+            threads[i] = NULL;
+        }
+
+        if (dl.failed)
+        {
+            THROW(ExceptionWorkerFailed, dl.code)
+        }
+    }
+    else if (nb_segs > 0)
+    {
+        LobDownloadProc(NULL, &dl);
+
+        CHECK(!dl.failed)
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        /* threads already started still process the whole lob on failure */
+
+        for (unsigned int i = 0; NULL != threads && i < nb_started; i++)
+        {
+            if (NULL != threads[i])
+            {
+                ThreadJoin(threads[i]);
+                ThreadFree(threads[i]);
+            }
+        }
+
+        FREE(threads)
+
+        if (NULL != dl.mutex)
+        {
+            MutexFree(dl.mutex);
+        }
+
+        if (NULL != stmt)
+        {
+            StatementFree(stmt);
+        }
+
+        if (NULL != con)
+        {
+            ConnectionFree(con);
+        }
+
+        LobDownloadCloseFile(&dl);
+    )
+}
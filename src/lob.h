@@ -42,6 +42,12 @@ boolean LobFree
     OCI_Lob *lob
 );
 
+boolean LobShrinkCache
+(
+    OCI_Connection *con,
+    unsigned int    size
+);
+
 OCI_Lob ** LobCreateArray
 (
     OCI_Connection *con,
@@ -101,6 +107,24 @@ unsigned int LobWrite
     unsigned int len
 );
 
+boolean LobArrayWrite
+(
+    OCI_Lob     **lobs,
+    unsigned int  count,
+    void        **buffers,
+    unsigned int *sizes
+);
+
+boolean LobDownload
+(
+    OCI_Pool          *pool,
+    const otext       *sql,
+    const otext       *filename,
+    unsigned int       nb_workers,
+    POCI_LOB_PROGRESS  handler,
+    void              *ctx
+);
+
 boolean LobTruncate
 (
     OCI_Lob *lob,
@@ -21,6 +21,7 @@
 #ifndef OCILIB_MACROS_H_INCLUDED
 #define OCILIB_MACROS_H_INCLUDED
 
+#include "environment.h"
 #include "error.h"
 #include "exception.h"
 #include "memory.h"
@@ -215,13 +216,42 @@ ExitLabel:                \
         THROW_NO_ARGS(ExceptionNotInitialized) \
     }
 
-#define CHECK_FEATURE(con, feat, ver)                                     \
-                                                                          \
-    if (Env.version_runtime < (ver) || ((con) && (con)->ver_num < (ver))) \
-    {                                                                     \
-        THROW(ExceptionNotAvailable, (feat))                              \
+#define CHECK_FEATURE(con, feat, ver)                                             \
+                                                                                  \
+    if (Env.version_runtime < (ver))                                              \
+    {                                                                             \
+        THROW(ExceptionNotAvailable, (feat))                                      \
+    }                                                                             \
+                                                                                  \
+    if (NULL != (con))                                                            \
+    {                                                                             \
+        OCI_Error *feat_err = ErrorGet(TRUE, TRUE);                               \
+                                                                                  \
+        const unsigned int feat_ver = ConnectionGetServerNumericVersion(con);     \
+                                                                                  \
+        CHECK_ERROR(feat_err)                                                     \
+                                                                                  \
+        if (feat_ver < (ver))                                                     \
+        {                                                                         \
+            THROW(ExceptionNotAvailable, (feat))                                  \
+        }                                                                         \
     }
 
+#ifdef OCI_IMPORT_RUNTIME
+
+#define CHECK_SYMBOLS(group)                     \
+                                                 \
+    if (!Env.sym_loaded[group])                  \
+    {                                            \
+        CHECK(EnvironmentLoadSymbols(group))     \
+    }
+
+#else
+
+#define CHECK_SYMBOLS(group)
+
+#endif
+
 #define CHECK_THREAD_ENABLED()           \
                                          \
     if (!(LIB_THREADED))                 \
@@ -2129,6 +2129,37 @@ typedef sword (*OCIARRAYDESCRIPTORFREE)
     const ub4 type
 );
 
+#ifdef ORAXB8_DEFINED
+
+typedef sword (*OCILOBARRAYWRITE)
+(
+    OCISvcCtx       *svchp,
+    OCIError        *errhp,
+    ub4             *array_iter,
+    OCILobLocator  **locp_arr,
+    oraub8          *byte_amt_arr,
+    oraub8          *char_amt_arr,
+    oraub8          *offset_arr,
+    dvoid          **bufp_arr,
+    oraub8          *bufl_arr,
+    ub1              piece,
+    dvoid           *ctxp,
+    sb4              (*cbfp)
+    (
+        dvoid       *ctxp,
+        ub4          array_iter,
+        dvoid       *bufp,
+        oraub8      *lenp,
+        ub1         *piecep,
+        dvoid      **changed_bufpp,
+        oraub8      *changed_lenp
+    ),
+    ub2              csid,
+    ub1              csfrm
+);
+
+#endif /* ORAXB8_DEFINED */
+
 /* API introduced in 11.2 */
 
 typedef sword (*OCILOBGETCONTENTTYPE)
@@ -173,6 +173,7 @@
 /*--------------------------Attribute Types----------------------------------*/
 
 #define OCI_ATTR_OBJECT   2 /* is the environment initialized in object mode */
+#define OCI_ATTR_NONBLOCKING_MODE  3                  /* non blocking mode */
 #define OCI_ATTR_SQLCODE  4                                  /* the SQL verb */
 #define OCI_ATTR_ENV  5                            /* the environment handle */
 #define OCI_ATTR_SERVER 6                               /* the server handle */
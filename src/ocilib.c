@@ -30,6 +30,7 @@
 #include "date.h"
 #include "dequeue.h"
 #include "dirpath.h"
+#include "dirpathloader.h"
 #include "element.h"
 #include "enqueue.h"
 #include "error.h"
@@ -47,6 +48,7 @@
 #include "number.h"
 #include "object.h"
 #include "pool.h"
+#include "poolrouter.h"
 #include "queue.h"
 #include "reference.h"
 #include "resultset.h"
@@ -610,6 +612,20 @@ OCI_Connection * OCI_API OCI_ConnectionCreate
     CALL_IMPL(ConnectionCreate, db, user, pwd, mode)
 }
 
+unsigned int OCI_API OCI_ConnectionCreateMany
+(
+    const otext     *db,
+    const otext     *user,
+    const otext     *pwd,
+    unsigned int     mode,
+    OCI_Connection **cons,
+    int             *codes,
+    unsigned int     count
+)
+{
+    CALL_IMPL(ConnectionCreateMany, db, user, pwd, mode, cons, codes, count)
+}
+
 boolean OCI_API OCI_ConnectionFree
 (
     OCI_Connection *con
@@ -954,6 +970,89 @@ boolean OCI_API OCI_SetStatementCacheSize
     CALL_IMPL(ConnectionSetStatementCacheSize, con, value)
 }
 
+unsigned int OCI_API OCI_GetPreparedCacheSize
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetPreparedCacheSize, con)
+}
+
+boolean OCI_API OCI_SetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    CALL_IMPL(ConnectionSetPreparedCacheSize, con, value)
+}
+
+unsigned int OCI_API OCI_GetPreparedCacheHits
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetPreparedCacheHits, con)
+}
+
+unsigned int OCI_API OCI_GetPreparedCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetPreparedCacheMisses, con)
+}
+
+unsigned int OCI_API OCI_GetTemporaryLobCacheSize
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetTemporaryLobCacheSize, con)
+}
+
+boolean OCI_API OCI_SetTemporaryLobCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    CALL_IMPL(ConnectionSetTemporaryLobCacheSize, con, value)
+}
+
+unsigned int OCI_API OCI_GetTemporaryLobCacheHits
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetTemporaryLobCacheHits, con)
+}
+
+unsigned int OCI_API OCI_GetTemporaryLobCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetTemporaryLobCacheMisses, con)
+}
+
+unsigned int OCI_API OCI_GetFormatArgsMode
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetFormatArgsMode, con)
+}
+
+boolean OCI_API OCI_SetFormatArgsMode
+(
+    OCI_Connection *con,
+    unsigned int    mode
+)
+{
+    CALL_IMPL(ConnectionSetFormatArgsMode, con, mode)
+}
+
 unsigned int OCI_API OCI_GetDefaultLobPrefetchSize
 (
     OCI_Connection *con
@@ -1496,6 +1595,34 @@ boolean OCI_API OCI_DirPathSetEntry
     CALL_IMPL(DirPathSetEntry, dp, row, index, value, size, complete)
 }
 
+boolean OCI_API OCI_DirPathSetEntries
+(
+    OCI_DirPath * dp,
+    unsigned int  row,
+    unsigned int  index,
+    unsigned int  count,
+    void        * values,
+    unsigned int  stride,
+    unsigned int* sizes,
+    boolean     * nulls
+)
+{
+    CALL_IMPL(DirPathSetEntries, dp, row, index, count, values, stride, sizes, nulls)
+}
+
+boolean OCI_API OCI_DirPathSetEntryByRef
+(
+    OCI_DirPath* dp,
+    unsigned int row,
+    unsigned int index,
+    const void * value,
+    unsigned int size,
+    boolean      complete
+)
+{
+    CALL_IMPL(DirPathSetEntryByRef, dp, row, index, value, size, complete)
+}
+
 unsigned int OCI_API OCI_DirPathConvert
 (
     OCI_DirPath* dp
@@ -1512,6 +1639,18 @@ unsigned int OCI_API OCI_DirPathLoad
     CALL_IMPL(DirPathLoad, dp)
 }
 
+boolean OCI_API OCI_DirPathLoadFile
+(
+    OCI_DirPath* dp,
+    const otext* filename,
+    otext        delimiter,
+    otext        quote,
+    unsigned int skip_lines
+)
+{
+    CALL_IMPL(DirPathLoadFile, dp, filename, delimiter, quote, skip_lines)
+}
+
 boolean OCI_API OCI_DirPathReset
 (
     OCI_DirPath* dp
@@ -1595,6 +1734,15 @@ boolean OCI_API OCI_DirPathSetParallel
     CALL_IMPL(DirPathSetParallel, dp, value)
 }
 
+boolean OCI_API OCI_DirPathSetPipelined
+(
+    OCI_DirPath* dp,
+    boolean      value
+)
+{
+    CALL_IMPL(DirPathSetPipelined, dp, value)
+}
+
 boolean OCI_API OCI_DirPathSetNoLog
 (
     OCI_DirPath* dp,
@@ -1663,6 +1811,132 @@ unsigned int OCI_API OCI_DirPathGetErrorRow
     CALL_IMPL(DirPathGetErrorRow, dp)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * direct path loader
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_DirPathLoader* OCI_API OCI_DirPathLoaderCreate
+(
+    OCI_TypeInfo* typinf,
+    const otext * partition,
+    unsigned int  nb_cols,
+    unsigned int  nb_rows,
+    unsigned int  nb_workers
+)
+{
+    CALL_IMPL(DirPathLoaderCreate, typinf, partition, nb_cols, nb_rows, nb_workers)
+}
+
+boolean OCI_API OCI_DirPathLoaderFree
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderFree, dpl)
+}
+
+boolean OCI_API OCI_DirPathLoaderSetColumn
+(
+    OCI_DirPathLoader* dpl,
+    unsigned int       index,
+    const otext*       name,
+    unsigned int       maxsize,
+    const otext*       format
+)
+{
+    CALL_IMPL(DirPathLoaderSetColumn, dpl, index, name, maxsize, format)
+}
+
+boolean OCI_API OCI_DirPathLoaderSetConvertMode
+(
+    OCI_DirPathLoader* dpl,
+    unsigned int       mode
+)
+{
+    CALL_IMPL(DirPathLoaderSetConvertMode, dpl, mode)
+}
+
+boolean OCI_API OCI_DirPathLoaderPrepare
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderPrepare, dpl)
+}
+
+OCI_DirPath* OCI_API OCI_DirPathLoaderGetBatch
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderGetBatch, dpl)
+}
+
+boolean OCI_API OCI_DirPathLoaderSubmit
+(
+    OCI_DirPathLoader* dpl,
+    OCI_DirPath*       dp
+)
+{
+    CALL_IMPL(DirPathLoaderSubmit, dpl, dp)
+}
+
+boolean OCI_API OCI_DirPathLoaderFinish
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderFinish, dpl)
+}
+
+boolean OCI_API OCI_DirPathLoaderAbort
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderAbort, dpl)
+}
+
+unsigned int OCI_API OCI_DirPathLoaderGetWorkerCount
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderGetWorkerCount, dpl)
+}
+
+unsigned int OCI_API OCI_DirPathLoaderGetRowCount
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderGetRowCount, dpl)
+}
+
+unsigned int OCI_API OCI_DirPathLoaderGetRejectedCount
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderGetRejectedCount, dpl)
+}
+
+unsigned int OCI_API OCI_DirPathLoaderGetErrorCount
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderGetErrorCount, dpl)
+}
+
+int OCI_API OCI_DirPathLoaderGetErrorCode
+(
+    OCI_DirPathLoader* dpl
+)
+{
+    CALL_IMPL(DirPathLoaderGetErrorCode, dpl)
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * element
  * --------------------------------------------------------------------------------------------- */
@@ -2996,6 +3270,14 @@ big_uint OCI_API OCI_GetAllocatedBytes
     CALL_IMPL(EnvironmentGetAllocatedBytes, mem_type)
 }
 
+boolean OCI_API OCI_GetInitStatistics
+(
+    OCI_InitStatistics *stats
+)
+{
+    CALL_IMPL(EnvironmentGetInitStatistics, stats)
+}
+
 OCI_Error* OCI_API OCI_GetLastError
 (
     void
@@ -3192,6 +3474,30 @@ boolean OCI_API OCI_LobWrite2
     CALL_IMPL(LobWrite2, lob, buffer, char_count, byte_count);
 }
 
+boolean OCI_API OCI_LobArrayWrite
+(
+    OCI_Lob     ** lobs,
+    unsigned int   count,
+    void        ** buffers,
+    unsigned int * sizes
+)
+{
+    CALL_IMPL(LobArrayWrite, lobs, count, buffers, sizes);
+}
+
+boolean OCI_API OCI_LobDownload
+(
+    OCI_Pool        * pool,
+    const otext     * sql,
+    const otext     * filename,
+    unsigned int      nb_workers,
+    POCI_LOB_PROGRESS handler,
+    void            * ctx
+)
+{
+    CALL_IMPL(LobDownload, pool, sql, filename, nb_workers, handler, ctx);
+}
+
 boolean OCI_API OCI_LobTruncate
 (
     OCI_Lob* lob,
@@ -4479,6 +4785,130 @@ boolean OCI_API OCI_PoolSetStatementCacheSize
     CALL_IMPL(PoolSetStatementCacheSize, pool, value);
 }
 
+boolean OCI_API OCI_PoolGetStatistics
+(
+    OCI_Pool           * pool,
+    OCI_PoolStatistics * stats
+)
+{
+    CALL_IMPL(PoolGetStatistics, pool, stats);
+}
+
+boolean OCI_API OCI_PoolResetStatistics
+(
+    OCI_Pool* pool
+)
+{
+    CALL_IMPL(PoolResetStatistics, pool);
+}
+
+boolean OCI_API OCI_PoolStartKeeper
+(
+    OCI_Pool   * pool,
+    unsigned int target,
+    unsigned int interval
+)
+{
+    CALL_IMPL(PoolStartKeeper, pool, target, interval);
+}
+
+boolean OCI_API OCI_PoolStopKeeper
+(
+    OCI_Pool* pool
+)
+{
+    CALL_IMPL(PoolStopKeeper, pool);
+}
+
+OCI_Connection * OCI_API OCI_PoolGetThreadConnection
+(
+    OCI_Pool* pool
+)
+{
+    CALL_IMPL(PoolGetThreadConnection, pool);
+}
+
+boolean OCI_API OCI_PoolReleaseThreadConnection
+(
+    OCI_Pool* pool
+)
+{
+    CALL_IMPL(PoolReleaseThreadConnection, pool);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ *  pool router
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_PoolRouter * OCI_API OCI_PoolRouterCreate
+(
+    void
+)
+{
+    CALL_IMPL(PoolRouterCreate)
+}
+
+boolean OCI_API OCI_PoolRouterFree
+(
+    OCI_PoolRouter* router
+)
+{
+    CALL_IMPL(PoolRouterFree, router);
+}
+
+boolean OCI_API OCI_PoolRouterAddPool
+(
+    OCI_PoolRouter* router,
+    OCI_Pool      * pool,
+    unsigned int    weight
+)
+{
+    CALL_IMPL(PoolRouterAddPool, router, pool, weight);
+}
+
+unsigned int OCI_API OCI_PoolRouterGetCount
+(
+    OCI_PoolRouter* router
+)
+{
+    CALL_IMPL(PoolRouterGetCount, router);
+}
+
+OCI_Pool * OCI_API OCI_PoolRouterGetPool
+(
+    OCI_PoolRouter* router,
+    unsigned int    index
+)
+{
+    CALL_IMPL(PoolRouterGetPool, router, index);
+}
+
+OCI_Connection * OCI_API OCI_PoolRouterGetConnection
+(
+    OCI_PoolRouter* router,
+    const otext   * tag
+)
+{
+    CALL_IMPL(PoolRouterGetConnection, router, tag);
+}
+
+unsigned int OCI_API OCI_PoolRouterGetBackOff
+(
+    OCI_PoolRouter* router
+)
+{
+    CALL_IMPL(PoolRouterGetBackOff, router);
+}
+
+boolean OCI_API OCI_PoolRouterSetBackOff
+(
+    OCI_PoolRouter* router,
+    unsigned int    value
+)
+{
+    CALL_IMPL(PoolRouterSetBackOff, router, value);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  *  queue
  * --------------------------------------------------------------------------------------------- */
@@ -4743,6 +5173,14 @@ boolean OCI_API OCI_FetchNext
     CALL_IMPL(ResultsetFetchNext, rs);
 }
 
+unsigned int OCI_API OCI_FetchNextAsync
+(
+    OCI_Resultset* rs
+)
+{
+    CALL_IMPL(ResultsetFetchNextAsync, rs);
+}
+
 boolean OCI_API OCI_FetchFirst
 (
     OCI_Resultset* rs
@@ -5305,6 +5743,24 @@ boolean OCI_API OCI_StatementFree
     CALL_IMPL(StatementFree, stmt);
 }
 
+OCI_Statement* OCI_API OCI_StatementAcquire
+(
+    OCI_Connection* con,
+    const otext   * sql,
+    const otext   * key
+)
+{
+    CALL_IMPL(StatementAcquire, con, sql, key);
+}
+
+boolean OCI_API OCI_StatementRelease
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementRelease, stmt);
+}
+
 boolean OCI_API OCI_ReleaseResultsets
 (
     OCI_Statement* stmt
@@ -5330,6 +5786,30 @@ boolean OCI_API OCI_Execute
     CALL_IMPL(StatementExecute, stmt);
 }
 
+boolean OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementExecuteAsync, stmt);
+}
+
+unsigned int OCI_API OCI_ExecutePoll
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementExecutePoll, stmt);
+}
+
+boolean OCI_API OCI_ExecuteWait
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementExecuteWait, stmt);
+}
+
 boolean OCI_API OCI_ExecuteStmt
 (
     OCI_Statement* stmt,
@@ -5639,6 +6119,18 @@ boolean OCI_API OCI_BindArrayOfStrings
     CALL_IMPL(StatementBindArrayOfStrings, stmt, name, data, len, nbelem);
 }
 
+boolean OCI_API OCI_BindArrayOfPackedStrings
+(
+    OCI_Statement* stmt,
+    const otext  * name,
+    void         * data,
+    unsigned int * offsets,
+    unsigned int   nbelem
+)
+{
+    CALL_IMPL(StatementBindArrayOfPackedStrings, stmt, name, data, offsets, nbelem);
+}
+
 boolean OCI_API OCI_BindRaw
 (
     OCI_Statement* stmt,
@@ -21,15 +21,245 @@
 #include "pool.h"
 
 #include "connection.h"
+#include "error.h"
+#include "helpers.h"
 #include "list.h"
 #include "macros.h"
+#include "mutex.h"
 #include "strings.h"
+#include "thread.h"
+#include "threadkey.h"
 
 static unsigned int PoolTypeValues[] =
 {
     OCI_POOL_CONNECTION, OCI_POOL_SESSION
 };
 
+/* upper bounds (in microseconds) of the checkout latency histogram buckets,
+   the last bucket holding all checkouts above the last bound */
+
+static big_uint PoolLatencyBounds[OCI_POOL_LATENCY_BUCKETS - 1] =
+{
+    100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000, 10000000
+};
+
+/* Oracle errors raised when no session could be obtained in time from a pool */
+
+static int PoolTimeoutErrors[] =
+{
+    24418, /* no wait mode and no session available */
+    24457, /* session pool get timeout */
+    24496  /* connection pool get timeout */
+};
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolUpdateSessionsCount
+ * --------------------------------------------------------------------------------------------- */
+
+static void PoolUpdateSessionsCount
+(
+    OCI_Pool *pool
+)
+{
+    /* OCI does not report pool growth or shrinkage, so the number of sessions
+       created and destroyed is derived from the observed number of opened sessions */
+
+    const ub4 opened = (ub4) PoolGetOpenedCount(pool);
+
+    if (opened > pool->stats_opened)
+    {
+        pool->stats.sessions_created += opened - pool->stats_opened;
+    }
+    else
+    {
+        pool->stats.sessions_destroyed += pool->stats_opened - opened;
+    }
+
+    pool->stats_opened = opened;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRecordCheckout
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean PoolRecordCheckout
+(
+    OCI_Pool       *pool,
+    OCI_Connection *con,
+    const otext    *tag,
+    ub4             busy,
+    ub4             opened,
+    big_uint        elapsed
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    boolean locked = FALSE;
+    size_t  i      = 0;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    if (NULL != pool->mutex)
+    {
+        CHECK(MutexAcquire(pool->mutex))
+
+        locked = TRUE;
+    }
+
+    if (NULL != con)
+    {
+        pool->stats.checkouts++;
+
+        if (IS_STRING_VALID(tag))
+        {
+            if (NULL != con->sess_tag)
+            {
+                pool->stats.tag_hits++;
+            }
+            else
+            {
+                pool->stats.tag_misses++;
+            }
+        }
+    }
+    else
+    {
+        OCI_Error *err = ErrorGet(FALSE, FALSE);
+
+        pool->stats.failures++;
+
+        for (i = 0; NULL != err && i < sizeof(PoolTimeoutErrors) / sizeof(PoolTimeoutErrors[0]); i++)
+        {
+            if (err->code == PoolTimeoutErrors[i])
+            {
+                pool->stats.timeouts++;
+                break;
+            }
+        }
+    }
+
+    /* a checkout has to wait when no idle session is available in the pool */
+
+    if (busy >= opened)
+    {
+        pool->stats.waits++;
+    }
+
+    /* keep track of the demand peak for the health keeper, leaving out the
+       sessions it holds itself while warming the pool */
+
+    busy = busy > pool->keeper_held ? busy - pool->keeper_held : 0;
+
+    if (busy + 1 > pool->busy_peak)
+    {
+        pool->busy_peak = busy + 1;
+    }
+
+    for (i = 0; i < sizeof(PoolLatencyBounds) / sizeof(PoolLatencyBounds[0]); i++)
+    {
+        if (elapsed < PoolLatencyBounds[i])
+        {
+            break;
+        }
+    }
+
+    pool->stats.latency_histogram[i]++;
+    pool->stats.latency_total += elapsed;
+
+    if (elapsed > pool->stats.latency_max)
+    {
+        pool->stats.latency_max = elapsed;
+    }
+
+    PoolUpdateSessionsCount(pool);
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(pool->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolDetachThreadConnection
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean PoolDetachThreadConnection
+(
+    OCI_Pool       *pool,
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    boolean locked = FALSE;
+    boolean found  = FALSE;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    if (NULL != pool->mutex)
+    {
+        CHECK(MutexAcquire(pool->mutex))
+
+        locked = TRUE;
+    }
+
+    for (ub4 i = 0; i < pool->thread_count; i++)
+    {
+        if (pool->thread_cons[i] == con)
+        {
+            pool->thread_count--;
+
+            pool->thread_cons[i] = pool->thread_cons[pool->thread_count];
+            pool->thread_cons[pool->thread_count] = NULL;
+
+            found = TRUE;
+            break;
+        }
+    }
+
+    SET_RETVAL(found)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(pool->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolThreadKeyDestroy
+ * --------------------------------------------------------------------------------------------- */
+
+static void PoolThreadKeyDestroy
+(
+    void *data
+)
+{
+    OCI_Connection *con = (OCI_Connection *) data;
+
+    /* called by OCI when a thread holding a connection exits */
+
+    if (NULL != con && NULL != con->pool && PoolDetachThreadConnection(con->pool, con))
+    {
+        ConnectionFree(con);
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * PoolDispose
  * --------------------------------------------------------------------------------------------- */
@@ -45,6 +275,14 @@ boolean PoolDispose
         /* context */ OCI_IPC_POOL, pool
     )
 
+    /* stop the health keeper before closing the pool */
+
+    PoolStopKeeper(pool);
+
+    /* return connections still bound to threads */
+
+    PoolReleaseThreadConnections(pool);
+
 #if OCI_VERSION_COMPILE >= OCI_9_0
 
     if (Env.version_runtime >= OCI_9_0)
@@ -114,6 +352,19 @@ boolean PoolDispose
     FREE(pool->user)
     FREE(pool->pwd)
 
+    /* free cached server metadata */
+
+    FREE(pool->ver_str)
+    FREE(pool->db_name)
+    FREE(pool->service_name)
+    FREE(pool->domain_name)
+
+    if (NULL != pool->mutex)
+    {
+        MutexFree(pool->mutex);
+        pool->mutex = NULL;
+    }
+
     ErrorResetSource(NULL, pool);
 
     SET_SUCCESS()
@@ -160,6 +411,7 @@ OCI_Pool * PoolCreate
     CHECK_INITIALIZED()
     CHECK_ENUM_VALUE( type, PoolTypeValues, OTEXT("Pool Type"))
     CHECK_MIN(max_con, 1)
+    CHECK_SYMBOLS(OCI_SYM_POOL)
 
     /* make sure that we do not have a XA session flag */
 
@@ -179,6 +431,12 @@ OCI_Pool * PoolCreate
     pool->user = ostrdup(user ? user : OTEXT(""));
     pool->pwd  = ostrdup(pwd  ? pwd  : OTEXT(""));
 
+    if (LIB_THREADED)
+    {
+        pool->mutex = MutexCreateInternal();
+        CHECK_NULL(pool->mutex)
+    }
+
 #if OCI_VERSION_COMPILE < OCI_9_2
 
     type = OCI_POOL_CONNECTION;
@@ -379,6 +637,13 @@ boolean PoolFree
 
     CHECK_PTR(OCI_IPC_POOL, pool)
 
+    /* routed pools are freed by their router */
+
+    if (NULL != pool->router)
+    {
+        THROW_NO_ARGS(ExceptionPoolRouted)
+    }
+
     PoolDispose(pool);
     ListRemove(Env.pools, pool);
 
@@ -405,9 +670,22 @@ OCI_Connection * PoolGetConnection
         /* context */ OCI_IPC_POOL, pool
     )
 
+    OCI_Connection *con = NULL;
+
+    big_uint start  = 0;
+    ub4      busy   = 0;
+    ub4      opened = 0;
+
     CHECK_PTR(OCI_IPC_POOL, pool)
 
-    OCI_Connection *con = ConnectionCreateInternal(pool, pool->db, pool->user, pool->pwd, pool->mode, tag);
+    busy   = (ub4) PoolGetBusyCount(pool);
+    opened = (ub4) PoolGetOpenedCount(pool);
+
+    start = ClockGetMicroseconds();
+
+    con = ConnectionCreateInternal(pool, pool->db, pool->user, pool->pwd, pool->mode, tag);
+
+    CHECK(PoolRecordCheckout(pool, con, tag, busy, opened, ClockGetMicroseconds() - start))
     CHECK_NULL(con)
 
     /* for regular connection pool, set the statement cache size to
@@ -898,3 +1176,592 @@ unsigned int PoolGetStatementCacheSize
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolGetStatistics
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolGetStatistics
+(
+    OCI_Pool           *pool,
+    OCI_PoolStatistics *stats
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+    CHECK_PTR(OCI_IPC_VOID, stats)
+
+    if (NULL != pool->mutex)
+    {
+        CHECK(MutexAcquire(pool->mutex))
+
+        locked = TRUE;
+    }
+
+    PoolUpdateSessionsCount(pool);
+
+    *stats = pool->stats;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(pool->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolResetStatistics
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolResetStatistics
+(
+    OCI_Pool *pool
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    if (NULL != pool->mutex)
+    {
+        CHECK(MutexAcquire(pool->mutex))
+
+        locked = TRUE;
+    }
+
+    memset(&pool->stats, 0, sizeof(pool->stats));
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(pool->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolKeeperSetMin
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean PoolKeeperSetMin
+(
+    OCI_Pool *pool,
+    ub4       min
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    dbtext *dbstr_db   = NULL;
+    dbtext *dbstr_user = NULL;
+    dbtext *dbstr_pwd  = NULL;
+    dbtext *dbstr_name = NULL;
+
+    int dbsize_db   = -1;
+    int dbsize_user = -1;
+    int dbsize_pwd  = -1;
+    int dbsize_name = -1;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    SET_SUCCESS()
+
+#if OCI_VERSION_COMPILE >= OCI_9_2
+
+    if (OCI_HTYPE_SPOOL == pool->htype && min != pool->keeper_min)
+    {
+        ub4 sess_mode = OCI_SPC_REINITIALIZE;
+
+        if (!(pool->mode & OCI_SESSION_SYSDBA) &&
+            IS_STRING_VALID(pool->user) &&
+            IS_STRING_VALID(pool->pwd))
+        {
+            sess_mode |= OCI_SPC_HOMOGENEOUS;
+        }
+
+        dbstr_db   = StringGetDBString(pool->db,   &dbsize_db);
+        dbstr_user = StringGetDBString(pool->user, &dbsize_user);
+        dbstr_pwd  = StringGetDBString(pool->pwd,  &dbsize_pwd);
+
+        /* only the sizes of an existing session pool can be changed */
+
+        CHECK_OCI
+        (
+            pool->err,
+            OCISessionPoolCreate,
+            Env.env, pool->err, (OCISPool *)pool->handle,
+            (OraText **) (dvoid *) &dbstr_name,
+            (ub4*) &dbsize_name,
+            (OraText *) dbstr_db, (sb4) dbsize_db,
+            (ub4)min, (ub4)pool->max,
+            (ub4)pool->incr, (OraText *) dbstr_user,
+            (sb4) dbsize_user, (OraText *) dbstr_pwd,
+            (sb4) dbsize_pwd,  (ub4) sess_mode
+        )
+
+        pool->keeper_min = min;
+    }
+
+#else
+
+    OCI_NOT_USED(min)
+    OCI_NOT_USED(dbstr_name)
+    OCI_NOT_USED(dbsize_name)
+
+#endif
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        StringReleaseDBString(dbstr_db);
+        StringReleaseDBString(dbstr_user);
+        StringReleaseDBString(dbstr_pwd);
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolKeeperRun
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean PoolKeeperRun
+(
+    OCI_Pool *pool
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    OCI_Connection *con = NULL;
+
+    ub4 target = 0;
+    ub4 busy   = 0;
+    ub4 idle   = 0;
+    ub4 i      = 0;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    /* connection pools only keep physical connections that are not checked out,
+       sessions retrieved from them are always new ones, so there is nothing to do */
+
+    SET_SUCCESS()
+
+    if (OCI_HTYPE_SPOOL != pool->htype)
+    {
+        JUMP_EXIT()
+    }
+
+    /* the expected demand is the busy peak observed since the previous run plus
+       the pool increment, so that sessions are opened before they are requested */
+
+    CHECK(MutexAcquire(pool->mutex))
+
+    busy   = (ub4) PoolGetBusyCount(pool);
+    idle   = (ub4) PoolGetOpenedCount(pool);
+    idle   = idle > busy ? idle - busy : 0;
+    target = pool->keeper_target;
+
+    if (pool->busy_peak + pool->incr > target)
+    {
+        target = pool->busy_peak + pool->incr;
+    }
+
+    /* the peak is restarted from the current demand at each run, so that it
+       decreases again once the load goes down */
+
+    pool->busy_peak = busy;
+
+    MutexRelease(pool->mutex);
+
+    if (target > pool->max)
+    {
+        target = pool->max;
+    }
+
+    /* warm up the pool by making OCI keep the target number of sessions opened,
+       idle sessions above it are still closed once the pool timeout set with
+       OCI_PoolSetTimeout() has elapsed */
+
+    CHECK(PoolKeeperSetMin(pool, target > pool->min ? target : pool->min))
+
+#if OCI_VERSION_COMPILE >= OCI_10_2
+
+    if (Env.version_runtime < OCI_10_2)
+    {
+        JUMP_EXIT()
+    }
+
+    /* check idle sessions one at a time, each one being handed back to the pool
+       before taking the next one, in order to never compete with the application */
+
+    for (i = 0; i < idle && i < target && !pool->keeper_stop; i++)
+    {
+        sword ret = OCI_SUCCESS;
+
+        CHECK(MutexAcquire(pool->mutex))
+        pool->keeper_held = 1;
+        MutexRelease(pool->mutex);
+
+        con = ConnectionCreateInternal(pool, pool->db, pool->user, pool->pwd, pool->mode, NULL);
+        CHECK_NULL(con)
+
+        ret = OCIPing(con->cxt, con->err, (ub4) OCI_DEFAULT);
+
+        con->sess_drop = (OCI_SUCCESS != ret && OCI_SUCCESS_WITH_INFO != ret);
+
+        ConnectionFree(con);
+        con = NULL;
+
+        CHECK(MutexAcquire(pool->mutex))
+        pool->keeper_held = 0;
+        MutexRelease(pool->mutex);
+    }
+
+#else
+
+    OCI_NOT_USED(con)
+    OCI_NOT_USED(idle)
+    OCI_NOT_USED(i)
+
+#endif
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != con)
+        {
+            ConnectionFree(con);
+        }
+
+        if (NULL != pool && MutexAcquire(pool->mutex))
+        {
+            pool->keeper_held = 0;
+
+            MutexRelease(pool->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolKeeperProc
+ * --------------------------------------------------------------------------------------------- */
+
+static void PoolKeeperProc
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_Pool *pool = (OCI_Pool *) arg;
+
+    OCI_NOT_USED(thread)
+
+    while (!pool->keeper_stop)
+    {
+        ub4 elapsed = 0;
+
+        PoolKeeperRun(pool);
+
+        /* sleep by small steps to exit quickly once asked to */
+
+        while (!pool->keeper_stop && elapsed < pool->keeper_interval * 1000)
+        {
+            ClockSleepMilliseconds(OCI_POOL_KEEPER_SLEEP_STEP);
+
+            elapsed += OCI_POOL_KEEPER_SLEEP_STEP;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolStartKeeper
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolStartKeeper
+(
+    OCI_Pool    *pool,
+    unsigned int target,
+    unsigned int interval
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+    CHECK_THREAD_ENABLED()
+    CHECK_MIN(interval, 1)
+
+    /* a running keeper picks up the new settings at its next run */
+
+    CHECK(MutexAcquire(pool->mutex))
+
+    pool->keeper_target   = (ub4) target;
+    pool->keeper_interval = (ub4) interval;
+
+    MutexRelease(pool->mutex);
+
+    if (NULL == pool->keeper)
+    {
+        pool->keeper_stop = FALSE;
+
+        pool->keeper = ThreadCreate();
+        CHECK_NULL(pool->keeper)
+
+        CHECK(ThreadRun(pool->keeper, PoolKeeperProc, pool))
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE && NULL != pool && NULL != pool->keeper)
+        {
+            ThreadFree(pool->keeper);
+            pool->keeper = NULL;
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolStopKeeper
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolStopKeeper
+(
+    OCI_Pool *pool
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    if (NULL != pool->keeper)
+    {
+        pool->keeper_stop = TRUE;
+
+        CHECK(ThreadJoin(pool->keeper))
+        CHECK(ThreadFree(pool->keeper))
+
+        pool->keeper = NULL;
+
+        /* give back the pool its own minimum size */
+
+        if (0 != pool->keeper_min)
+        {
+            CHECK(PoolKeeperSetMin(pool, pool->min))
+
+            pool->keeper_min = 0;
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolGetThreadConnection
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Connection * PoolGetThreadConnection
+(
+    OCI_Pool *pool
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Connection*, NULL,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    OCI_Connection *con = NULL;
+
+    boolean locked   = FALSE;
+    boolean acquired = FALSE;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    /* connection already bound to the calling thread : no lock needed */
+
+    if (NULL != pool->thread_key)
+    {
+        CHECK(ThreadKeyGet(pool->thread_key, (void **) &con))
+    }
+
+    if (NULL == con)
+    {
+        if (NULL != pool->mutex)
+        {
+            CHECK(MutexAcquire(pool->mutex))
+
+            locked = TRUE;
+        }
+
+        if (NULL == pool->thread_key)
+        {
+            pool->thread_key = ThreadKeyCreateInternal(PoolThreadKeyDestroy);
+            CHECK_NULL(pool->thread_key)
+        }
+
+        /* the pool lock is not held while waiting for a session */
+
+        if (locked)
+        {
+            MutexRelease(pool->mutex);
+
+            locked = FALSE;
+        }
+
+        con = PoolGetConnection(pool, NULL);
+        CHECK_NULL(con)
+
+        acquired = TRUE;
+
+        if (NULL != pool->mutex)
+        {
+            CHECK(MutexAcquire(pool->mutex))
+
+            locked = TRUE;
+        }
+
+        REALLOC_DATA
+        (
+            OCI_IPC_CONNECTION_ARRAY,
+            pool->thread_cons,
+            pool->thread_count,
+            pool->thread_alloc,
+            pool->thread_count + OCI_POOL_THREAD_CONS_INC
+        )
+
+        CHECK(ThreadKeySet(pool->thread_key, con))
+
+        pool->thread_cons[pool->thread_count++] = con;
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(pool->mutex);
+        }
+
+        if (FAILURE && acquired)
+        {
+            ConnectionFree(con);
+            con = NULL;
+        }
+
+        SET_RETVAL(con)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolReleaseThreadConnection
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolReleaseThreadConnection
+(
+    OCI_Pool *pool
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    OCI_Connection *con = NULL;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    if (NULL != pool->thread_key)
+    {
+        CHECK(ThreadKeyGet(pool->thread_key, (void **) &con))
+    }
+
+    if (NULL != con)
+    {
+        CHECK(ThreadKeySet(pool->thread_key, NULL))
+
+        if (PoolDetachThreadConnection(pool, con))
+        {
+            CHECK(ConnectionFree(con))
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolReleaseThreadConnections
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolReleaseThreadConnections
+(
+    OCI_Pool *pool
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    /* freeing the key first prevents exiting threads from releasing their connection */
+
+    if (NULL != pool->thread_key)
+    {
+        ThreadKeyFree(pool->thread_key);
+
+        pool->thread_key = NULL;
+    }
+
+    while (pool->thread_count > 0)
+    {
+        pool->thread_count--;
+
+        ConnectionFree(pool->thread_cons[pool->thread_count]);
+    }
+
+    FREE(pool->thread_cons)
+
+    pool->thread_alloc = 0;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
@@ -109,4 +109,42 @@ unsigned int PoolGetStatementCacheSize
     OCI_Pool *pool
 );
 
+boolean PoolGetStatistics
+(
+    OCI_Pool           *pool,
+    OCI_PoolStatistics *stats
+);
+
+boolean PoolResetStatistics
+(
+    OCI_Pool *pool
+);
+
+boolean PoolStartKeeper
+(
+    OCI_Pool    *pool,
+    unsigned int target,
+    unsigned int interval
+);
+
+boolean PoolStopKeeper
+(
+    OCI_Pool *pool
+);
+
+OCI_Connection * PoolGetThreadConnection
+(
+    OCI_Pool *pool
+);
+
+boolean PoolReleaseThreadConnection
+(
+    OCI_Pool *pool
+);
+
+boolean PoolReleaseThreadConnections
+(
+    OCI_Pool *pool
+);
+
 #endif /* OCILIB_POOL_H_INCLUDED */
@@ -0,0 +1,491 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "poolrouter.h"
+
+#include "error.h"
+#include "helpers.h"
+#include "list.h"
+#include "macros.h"
+#include "memory.h"
+#include "mutex.h"
+#include "pool.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterSelect
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int PoolRouterSelect
+(
+    OCI_PoolRouter *router,
+    boolean        *tried,
+    unsigned int    count
+)
+{
+    /* pools are ranked first on their availability (healthy, saturated, backing off
+       after a failure) and then on a cost computed from their load, observed latency
+       and weight. A pool that has to open a new session gets an extra unit of load */
+
+    const big_uint now = ClockGetMicroseconds();
+
+    unsigned int best      = 0;
+    unsigned int best_rank = 0;
+    big_uint     best_cost = 0;
+    boolean      found     = FALSE;
+    unsigned int i         = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        OCI_PoolRouterEntry *entry = &router->entries[i];
+
+        unsigned int rank = 0;
+        big_uint     cost = 0;
+        big_uint     load = 0;
+        ub4          busy = 0;
+
+        if (tried[i])
+        {
+            continue;
+        }
+
+        busy = (ub4) PoolGetBusyCount(entry->pool);
+        load = (big_uint) busy + 1;
+
+        if (busy >= (ub4) PoolGetOpenedCount(entry->pool))
+        {
+            load++;
+        }
+
+        if (entry->retry_time > now)
+        {
+            rank = 2;
+        }
+        else if (busy >= entry->pool->max)
+        {
+            rank = 1;
+        }
+
+        cost = load * (entry->latency + OCI_POOL_ROUTER_LATENCY_BASE) / entry->weight;
+
+        if (!found || rank < best_rank || (rank == best_rank && cost < best_cost))
+        {
+            best      = i;
+            best_rank = rank;
+            best_cost = cost;
+            found     = TRUE;
+        }
+    }
+
+    return best;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_PoolRouter * PoolRouterCreate
+(
+    void
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_PoolRouter*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_PoolRouter *router = NULL;
+
+    CHECK_INITIALIZED()
+
+    router = ListAppend(Env.routers, sizeof(*router));
+    CHECK_NULL(router)
+
+    router->backoff = OCI_POOL_ROUTER_BACKOFF;
+
+    if (LIB_THREADED)
+    {
+        router->mutex = MutexCreateInternal();
+        CHECK_NULL(router->mutex)
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            PoolRouterFree(router);
+            router = NULL;
+        }
+
+        SET_RETVAL(router)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterDispose
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolRouterDispose
+(
+    OCI_PoolRouter *router
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL_ROUTER, router
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_POOL_ROUTER, router)
+
+    /* give back pools, they are then either freed by PoolRouterFree() or
+       disposed with the other pools by OCI_Cleanup() */
+
+    for (i = 0; i < router->count; i++)
+    {
+        router->entries[i].pool->router = NULL;
+    }
+
+    if (NULL != router->mutex)
+    {
+        MutexFree(router->mutex);
+        router->mutex = NULL;
+    }
+
+    ErrorResetSource(NULL, router);
+
+    FREE(router->entries)
+
+    router->count     = 0;
+    router->allocated = 0;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolRouterFree
+(
+    OCI_PoolRouter *router
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL_ROUTER, router
+    )
+
+    unsigned int i = 0;
+
+    CHECK_PTR(OCI_IPC_POOL_ROUTER, router)
+
+    /* the router owns its pools, they are freed once detached from it */
+
+    for (i = 0; i < router->count; i++)
+    {
+        router->entries[i].pool->router = NULL;
+
+        PoolFree(router->entries[i].pool);
+    }
+
+    router->count = 0;
+
+    PoolRouterDispose(router);
+    ListRemove(Env.routers, router);
+
+    FREE(router)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterAddPool
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolRouterAddPool
+(
+    OCI_PoolRouter *router,
+    OCI_Pool       *pool,
+    unsigned int    weight
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL_ROUTER, router
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_POOL_ROUTER, router)
+    CHECK_PTR(OCI_IPC_POOL, pool)
+    CHECK_MIN(weight, 1)
+
+    if (NULL != pool->router)
+    {
+        THROW_NO_ARGS(ExceptionPoolRouted)
+    }
+
+    if (NULL != router->mutex)
+    {
+        CHECK(MutexAcquire(router->mutex))
+
+        locked = TRUE;
+    }
+
+    REALLOC_DATA
+    (
+        OCI_IPC_ROUTER_ENTRY_ARRAY,
+        router->entries,
+        router->count,
+        router->allocated,
+        router->count + OCI_POOL_ROUTER_ENTRY_INC
+    )
+
+    router->entries[router->count].pool       = pool;
+    router->entries[router->count].weight     = weight;
+    router->entries[router->count].latency    = 0;
+    router->entries[router->count].retry_time = 0;
+
+    router->count++;
+
+    pool->router = router;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(router->mutex);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterGetCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int PoolRouterGetCount
+(
+    OCI_PoolRouter *router
+)
+{
+    GET_PROP
+    (
+        unsigned int, 0,
+        OCI_IPC_POOL_ROUTER, router,
+        count
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterGetPool
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Pool * PoolRouterGetPool
+(
+    OCI_PoolRouter *router,
+    unsigned int    index
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Pool*, NULL,
+        /* context */ OCI_IPC_POOL_ROUTER, router
+    )
+
+    CHECK_PTR(OCI_IPC_POOL_ROUTER, router)
+    CHECK_BOUND(index, 1, router->count)
+
+    SET_RETVAL(router->entries[index - 1].pool)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterGetConnection
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Connection * PoolRouterGetConnection
+(
+    OCI_PoolRouter *router,
+    const otext    *tag
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Connection*, NULL,
+        /* context */ OCI_IPC_POOL_ROUTER, router
+    )
+
+    OCI_Connection *con    = NULL;
+    boolean        *tried  = NULL;
+    boolean         locked = FALSE;
+
+    unsigned int count   = 0;
+    unsigned int attempt = 0;
+
+    CHECK_PTR(OCI_IPC_POOL_ROUTER, router)
+
+    /* pools added while routing are only considered by later calls */
+
+    count = router->count;
+
+    if (0 == count)
+    {
+        THROW(ExceptionOutOfBounds, 1)
+    }
+
+    ALLOC_DATA(OCI_IPC_BOOLEAN, tried, count)
+
+    /* each pool is tried at most once, from the best to the worst candidate */
+
+    for (attempt = 0; attempt < count && NULL == con; attempt++)
+    {
+        OCI_Pool    *pool  = NULL;
+        unsigned int index = 0;
+        big_uint     start = 0;
+        big_uint     now   = 0;
+
+        if (NULL != router->mutex)
+        {
+            CHECK(MutexAcquire(router->mutex))
+
+            locked = TRUE;
+        }
+
+        index = PoolRouterSelect(router, tried, count);
+        pool  = router->entries[index].pool;
+
+        if (locked)
+        {
+            MutexRelease(router->mutex);
+
+            locked = FALSE;
+        }
+
+        tried[index] = TRUE;
+
+        start = ClockGetMicroseconds();
+        con   = PoolGetConnection(pool, tag);
+        now   = ClockGetMicroseconds();
+
+        if (NULL != router->mutex)
+        {
+            CHECK(MutexAcquire(router->mutex))
+
+            locked = TRUE;
+        }
+
+        if (NULL != con)
+        {
+            OCI_PoolRouterEntry *entry = &router->entries[index];
+
+            /* exponential moving average of the checkout latency */
+
+            if (0 == entry->latency)
+            {
+                entry->latency = now - start;
+            }
+            else
+            {
+                entry->latency = (entry->latency * 7 + (now - start)) / 8;
+            }
+
+            entry->retry_time = 0;
+        }
+        else
+        {
+            router->entries[index].retry_time = now + (big_uint) router->backoff * 1000000;
+        }
+
+        if (locked)
+        {
+            MutexRelease(router->mutex);
+
+            locked = FALSE;
+        }
+    }
+
+    CHECK_NULL(con)
+
+    /* errors raised by pools that failed before a successful one are irrelevant */
+
+    if (attempt > 1)
+    {
+        ErrorReset(ErrorGet(FALSE, FALSE));
+    }
+
+    SET_RETVAL(con)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            MutexRelease(router->mutex);
+        }
+
+        FREE(tried)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterGetBackOff
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int PoolRouterGetBackOff
+(
+    OCI_PoolRouter *router
+)
+{
+    GET_PROP
+    (
+        unsigned int, 0,
+        OCI_IPC_POOL_ROUTER, router,
+        backoff
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolRouterSetBackOff
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolRouterSetBackOff
+(
+    OCI_PoolRouter *router,
+    unsigned int    value
+)
+{
+    SET_PROP
+    (
+        /* handle */ OCI_IPC_POOL_ROUTER, router,
+        /* member */ backoff, unsigned int,
+        /* value  */ value
+    )
+}
@@ -0,0 +1,76 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_POOLROUTER_H_INCLUDED
+#define OCILIB_POOLROUTER_H_INCLUDED
+
+#include "types.h"
+
+OCI_PoolRouter * PoolRouterCreate
+(
+    void
+);
+
+boolean PoolRouterDispose
+(
+    OCI_PoolRouter *router
+);
+
+boolean PoolRouterFree
+(
+    OCI_PoolRouter *router
+);
+
+boolean PoolRouterAddPool
+(
+    OCI_PoolRouter *router,
+    OCI_Pool       *pool,
+    unsigned int    weight
+);
+
+unsigned int PoolRouterGetCount
+(
+    OCI_PoolRouter *router
+);
+
+OCI_Pool * PoolRouterGetPool
+(
+    OCI_PoolRouter *router,
+    unsigned int    index
+);
+
+OCI_Connection * PoolRouterGetConnection
+(
+    OCI_PoolRouter *router,
+    const otext    *tag
+);
+
+unsigned int PoolRouterGetBackOff
+(
+    OCI_PoolRouter *router
+);
+
+boolean PoolRouterSetBackOff
+(
+    OCI_PoolRouter *router,
+    unsigned int    value
+);
+
+#endif /* OCILIB_POOLROUTER_H_INCLUDED */
@@ -20,6 +20,7 @@
 
 #include "queue.h"
 
+#include "connection.h"
 #include "macros.h"
 #include "statement.h"
 
@@ -619,7 +620,7 @@ boolean QueueTablePurge
     CHECK_PTR(OCI_IPC_CONNECTION, con)
     CHECK_PTR(OCI_IPC_STRING,     queue_table)
     CHECK_ENUM_VALUE(delivery_mode, DeliveryModeValues, OTEXT("Delivery mode"))
-    CHECK(con->ver_num >= OCI_10_1)
+    CHECK(ConnectionGetServerNumericVersion(con) >= OCI_10_1)
 
     st = StatementCreate(con);
     CHECK_NULL(st)
@@ -22,6 +22,7 @@
 
 #include "collection.h"
 #include "column.h"
+#include "connection.h"
 #include "date.h"
 #include "define.h"
 #include "error.h"
@@ -659,6 +660,17 @@ boolean ResultsetFetchData
         /* need to do a piecewise fetch */
         CHECK(ResultsetFetchPieces(rs))
     }
+    else if (OCI_STILL_EXECUTING == rs->fetch_status)
+    {
+        /* non blocking fetch not completed yet */
+
+        if (OCI_ASYNC_CALL_FETCH != rs->stmt->async_call)
+        {
+            THROW(ExceptionOCI, rs->stmt->con->err, rs->fetch_status)
+        }
+
+        CHECK(FALSE)
+    }
 
     /* check string buffer for Unicode builds that need buffer expansion */
 
@@ -1079,6 +1091,71 @@ boolean ResultsetFetchNext
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetFetchNextAsync
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ResultsetFetchNextAsync
+(
+    OCI_Resultset *rs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_ASYNC_FAILURE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+
+    OCI_Statement *stmt = rs->stmt;
+
+    if (OCI_ASYNC_CALL_EXECUTE == stmt->async_call)
+    {
+        THROW_NO_ARGS(ExceptionAsyncCallPending)
+    }
+
+    /* a server round trip is only required once all fetched rows have been consumed */
+
+    if ((OCI_ASYNC_CALL_NONE == stmt->async_call) &&
+        (rs->eof || stmt->nb_rbinds > 0 || rs->row_cur < rs->row_fetched ||
+         OCI_NO_DATA == rs->fetch_status))
+    {
+        SET_RETVAL(ResultsetFetchNext(rs) ? OCI_ASYNC_SUCCESS : OCI_ASYNC_FAILURE)
+        JUMP_EXIT()
+    }
+
+    if (OCI_ASYNC_CALL_NONE == stmt->async_call)
+    {
+        CHECK(ConnectionSetNonBlockingMode(stmt->con, TRUE))
+
+        stmt->async_call = OCI_ASYNC_CALL_FETCH;
+    }
+
+    const boolean res = ResultsetFetchData(rs, OCI_SFD_NEXT, 0);
+
+    if (OCI_STILL_EXECUTING == rs->fetch_status)
+    {
+        SET_RETVAL(OCI_ASYNC_EXECUTING)
+        JUMP_EXIT()
+    }
+
+    stmt->async_call = OCI_ASYNC_CALL_NONE;
+
+    CHECK(ConnectionSetNonBlockingMode(stmt->con, FALSE))
+    CHECK(res)
+
+    rs->bof     = FALSE;
+    rs->row_cur = 1;
+
+    rs->row_abs++;
+
+    SET_RETVAL(OCI_ASYNC_SUCCESS)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ResultsetFetchFirst
  * --------------------------------------------------------------------------------------------- */
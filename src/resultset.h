@@ -49,6 +49,11 @@ boolean ResultsetFetchNext
     OCI_Resultset* rs
 );
 
+unsigned int ResultsetFetchNextAsync
+(
+    OCI_Resultset* rs
+);
+
 boolean ResultsetFetchFirst
 (
     OCI_Resultset* rs
@@ -0,0 +1,249 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rwlock.h"
+
+#include "macros.h"
+#include "memory.h"
+
+#if defined(_WINDOWS)
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+/* OCI does not provide any reader/writer lock, thus native ones are used and
+   the structure is kept private to this module to avoid spreading system headers */
+
+struct OCI_RWLock
+{
+#if defined(_WINDOWS)
+    SRWLOCK          handle;    /* Windows slim reader/writer lock */
+#else
+    pthread_rwlock_t handle;    /* POSIX reader/writer lock */
+#endif
+};
+
+/* --------------------------------------------------------------------------------------------- *
+ * RWLockCreateInternal
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_RWLock * RWLockCreateInternal
+(
+    void
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_RWLock*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    /* allocate lock structure */
+
+    OCI_RWLock *lock = NULL;
+
+    ALLOC_DATA(OCI_IPC_RWLOCK, lock, 1)
+
+    /* initialize native lock */
+
+#if defined(_WINDOWS)
+
+    InitializeSRWLock(&lock->handle);
+
+#else
+
+    if (0 != pthread_rwlock_init(&lock->handle, NULL))
+    {
+        THROW(ExceptionMemory, OCI_IPC_RWLOCK, sizeof(*lock))
+    }
+
+#endif
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            FREE(lock)
+        }
+
+        SET_RETVAL(lock)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * RWLockFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean RWLockFree
+(
+    OCI_RWLock *lock
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RWLOCK, lock
+    )
+
+    CHECK_PTR(OCI_IPC_RWLOCK, lock)
+
+#if !defined(_WINDOWS)
+
+    pthread_rwlock_destroy(&lock->handle);
+
+#endif
+
+    ErrorResetSource(NULL, lock);
+
+    FREE(lock)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * RWLockAcquireRead
+ * --------------------------------------------------------------------------------------------- */
+
+boolean RWLockAcquireRead
+(
+    OCI_RWLock *lock
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RWLOCK, lock
+    )
+
+    CHECK_PTR(OCI_IPC_RWLOCK, lock)
+
+#if defined(_WINDOWS)
+
+    AcquireSRWLockShared(&lock->handle);
+
+#else
+
+    CHECK(0 == pthread_rwlock_rdlock(&lock->handle))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * RWLockReleaseRead
+ * --------------------------------------------------------------------------------------------- */
+
+boolean RWLockReleaseRead
+(
+    OCI_RWLock *lock
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RWLOCK, lock
+    )
+
+    CHECK_PTR(OCI_IPC_RWLOCK, lock)
+
+#if defined(_WINDOWS)
+
+    ReleaseSRWLockShared(&lock->handle);
+
+#else
+
+    CHECK(0 == pthread_rwlock_unlock(&lock->handle))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * RWLockAcquireWrite
+ * --------------------------------------------------------------------------------------------- */
+
+boolean RWLockAcquireWrite
+(
+    OCI_RWLock *lock
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RWLOCK, lock
+    )
+
+    CHECK_PTR(OCI_IPC_RWLOCK, lock)
+
+#if defined(_WINDOWS)
+
+    AcquireSRWLockExclusive(&lock->handle);
+
+#else
+
+    CHECK(0 == pthread_rwlock_wrlock(&lock->handle))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * RWLockReleaseWrite
+ * --------------------------------------------------------------------------------------------- */
+
+boolean RWLockReleaseWrite
+(
+    OCI_RWLock *lock
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RWLOCK, lock
+    )
+
+    CHECK_PTR(OCI_IPC_RWLOCK, lock)
+
+#if defined(_WINDOWS)
+
+    ReleaseSRWLockExclusive(&lock->handle);
+
+#else
+
+    CHECK(0 == pthread_rwlock_unlock(&lock->handle))
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
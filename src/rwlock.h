@@ -0,0 +1,56 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_RWLOCK_H_INCLUDED
+#define OCILIB_RWLOCK_H_INCLUDED
+
+#include "types.h"
+
+OCI_RWLock * RWLockCreateInternal
+(
+    void
+);
+
+boolean RWLockFree
+(
+    OCI_RWLock *lock
+);
+
+boolean RWLockAcquireRead
+(
+    OCI_RWLock *lock
+);
+
+boolean RWLockReleaseRead
+(
+    OCI_RWLock *lock
+);
+
+boolean RWLockAcquireWrite
+(
+    OCI_RWLock *lock
+);
+
+boolean RWLockReleaseWrite
+(
+    OCI_RWLock *lock
+);
+
+#endif /* OCILIB_RWLOCK_H_INCLUDED */
@@ -369,6 +369,7 @@ boolean StatementReset
 
     FREE(stmt->sql)
     FREE(stmt->sql_id)
+    FREE(stmt->cache_key)
 
     stmt->rsts   = NULL;
     stmt->stmts  = NULL;
@@ -1335,13 +1336,13 @@ boolean StatementPrepareInternal
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * StatementExecuteInternal
+ * StatementExecuteBegin
  * --------------------------------------------------------------------------------------------- */
 
-boolean StatementExecuteInternal
+static boolean StatementExecuteBegin
 (
     OCI_Statement *stmt,
-    ub4            mode
+    ub4           *mode
 )
 {
     ENTER_FUNC
@@ -1352,24 +1353,17 @@ boolean StatementExecuteInternal
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
 
-    ub4 iters = 0;
-
-    /* set up iterations and mode values for execution */
+    /* set up mode value for execution */
 
     if (OCI_CST_SELECT == stmt->type)
     {
-        mode |= stmt->exec_mode;
+        *mode |= stmt->exec_mode;
     }
-    else
+    else if (stmt->nb_iters > 1)
     {
-        iters = stmt->nb_iters;
-
         /* for array DML, use batch error mode */
 
-        if (iters > 1)
-        {
-            mode = mode | OCI_BATCH_ERRORS;
-        }
+        *mode |= OCI_BATCH_ERRORS;
     }
 
     /* reset batch errors */
@@ -1403,11 +1397,50 @@ boolean StatementExecuteInternal
         }
     }
 
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteCall
+ * --------------------------------------------------------------------------------------------- */
+
+static sword StatementExecuteCall
+(
+    OCI_Statement *stmt,
+    ub4            mode
+)
+{
+    /* set up iterations for execution */
+
+    const ub4 iters = (OCI_CST_SELECT == stmt->type) ? 0 : stmt->nb_iters;
+
     /* Oracle execute call */
 
-    const sword ret = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, 
-                                     iters, (ub4)0, (OCISnapshot *)NULL, 
-                                     (OCISnapshot *)NULL, mode);
+    return OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err,
+                          iters, (ub4)0, (OCISnapshot *)NULL,
+                          (OCISnapshot *)NULL, mode);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteEnd
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean StatementExecuteEnd
+(
+    OCI_Statement *stmt,
+    ub4            mode,
+    sword          ret
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
 
     /* check result */
 
@@ -1500,6 +1533,37 @@ boolean StatementExecuteInternal
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteInternal
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementExecuteInternal
+(
+    OCI_Statement *stmt,
+    ub4            mode
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (OCI_ASYNC_CALL_NONE != stmt->async_call)
+    {
+        THROW_NO_ARGS(ExceptionAsyncCallPending)
+    }
+
+    CHECK(StatementExecuteBegin(stmt, &mode))
+    CHECK(StatementExecuteEnd(stmt, mode, StatementExecuteCall(stmt, mode)))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StatementCreate
  * --------------------------------------------------------------------------------------------- */
@@ -1545,6 +1609,13 @@ boolean StatementFree
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_OBJECT_FETCHED(stmt)
 
+    /* released statements are owned by the prepared cache */
+
+    if (stmt->released)
+    {
+        THROW_NO_ARGS(ExceptionStatementReleased)
+    }
+
     StatementDispose(stmt);
     ListRemove(stmt->con->stmts, stmt);
 
@@ -1555,6 +1626,175 @@ boolean StatementFree
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementMatchCacheKey
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean StatementMatchCacheKey
+(
+    OCI_Statement *stmt,
+    const otext   *sql,
+    const otext   *key
+)
+{
+    if (NULL == stmt->sql || ostrcmp(stmt->sql, sql) != 0)
+    {
+        return FALSE;
+    }
+
+    if (!IS_STRING_VALID(key) || !IS_STRING_VALID(stmt->cache_key))
+    {
+        return (!IS_STRING_VALID(key) && !IS_STRING_VALID(stmt->cache_key));
+    }
+
+    return (ostrcmp(stmt->cache_key, key) == 0);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementAcquire
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Statement * StatementAcquire
+(
+    OCI_Connection *con,
+    const otext    *sql,
+    const otext    *key
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Statement*, NULL,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    OCI_Statement *stmt = NULL;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_STRING,     sql)
+
+    /* look for a released statement with the same SQL and bind signature */
+
+    for (unsigned int i = 0; i < con->prep_count; i++)
+    {
+        if (StatementMatchCacheKey(con->prep_stmts[i], sql, key))
+        {
+            stmt = con->prep_stmts[i];
+
+            stmt->released = FALSE;
+
+            /* checked out statements are removed from the cache */
+
+            con->prep_count--;
+
+            memmove(&con->prep_stmts[i], &con->prep_stmts[i + 1],
+                    (size_t) (con->prep_count - i) * sizeof(*con->prep_stmts));
+
+            con->prep_stmts[con->prep_count] = NULL;
+
+            break;
+        }
+    }
+
+    if (NULL != stmt)
+    {
+        con->prep_hits++;
+    }
+    else
+    {
+        con->prep_misses++;
+
+        stmt = StatementCreate(con);
+        CHECK_NULL(stmt)
+
+        CHECK(StatementPrepareInternal(stmt, sql))
+
+        if (IS_STRING_VALID(key))
+        {
+            stmt->cache_key = ostrdup(key);
+            CHECK_NULL(stmt->cache_key)
+        }
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE && NULL != stmt)
+        {
+            StatementFree(stmt);
+            stmt = NULL;
+        }
+
+        SET_RETVAL(stmt)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementRelease
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementRelease
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_Connection *con = NULL;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_OBJECT_FETCHED(stmt)
+
+    /* a statement released twice would be handed out twice by the cache */
+
+    if (stmt->released)
+    {
+        THROW_NO_ARGS(ExceptionStatementReleased)
+    }
+
+    con = stmt->con;
+
+    /* statements that cannot be reused are freed */
+
+    if (0 == con->prep_size || NULL == stmt->sql || !(stmt->status & OCI_STMT_PREPARED))
+    {
+        CHECK(StatementFree(stmt))
+    }
+    else
+    {
+        ALLOC_DATA(OCI_IPC_STATEMENT_ARRAY, con->prep_stmts, con->prep_size)
+
+        /* evict the least recently used statement if the cache is full */
+
+        if (con->prep_count >= con->prep_size)
+        {
+            OCI_Statement *lru = con->prep_stmts[--con->prep_count];
+
+            con->prep_stmts[con->prep_count] = NULL;
+
+            lru->released = FALSE;
+
+            CHECK(StatementFree(lru))
+        }
+
+        /* most recently used statements are kept at the head of the cache */
+
+        memmove(&con->prep_stmts[1], &con->prep_stmts[0],
+                (size_t) con->prep_count * sizeof(*con->prep_stmts));
+
+        con->prep_stmts[0] = stmt;
+        con->prep_count++;
+
+        stmt->released = TRUE;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StatementGetResultset
  * --------------------------------------------------------------------------------------------- */
@@ -1741,6 +1981,138 @@ boolean StatementExecute
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteAsync
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementExecuteAsync
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    ub4 mode = OCI_DEFAULT;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    if (OCI_ASYNC_CALL_NONE != stmt->async_call)
+    {
+        THROW_NO_ARGS(ExceptionAsyncCallPending)
+    }
+
+    CHECK(StatementExecuteBegin(stmt, &mode))
+
+    /* switch the server handle to non blocking mode until the call completes */
+
+    CHECK(ConnectionSetNonBlockingMode(stmt->con, TRUE))
+
+    stmt->async_mode   = mode;
+    stmt->async_call   = OCI_ASYNC_CALL_EXECUTE;
+    stmt->async_status = OCI_ASYNC_EXECUTING;
+
+    CHECK(OCI_ASYNC_FAILURE != StatementExecutePoll(stmt))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecutePoll
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int StatementExecutePoll
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_ASYNC_FAILURE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (OCI_ASYNC_CALL_EXECUTE == stmt->async_call)
+    {
+        /* a pending non blocking call is completed by calling it again */
+
+        const sword ret = StatementExecuteCall(stmt, stmt->async_mode);
+
+        if (OCI_STILL_EXECUTING == ret)
+        {
+            SET_RETVAL(OCI_ASYNC_EXECUTING)
+            JUMP_EXIT()
+        }
+
+        stmt->async_call   = OCI_ASYNC_CALL_NONE;
+        stmt->async_status = OCI_ASYNC_FAILURE;
+
+        /* back to blocking mode before any post execution processing */
+
+        CHECK(ConnectionSetNonBlockingMode(stmt->con, FALSE))
+        CHECK(StatementExecuteEnd(stmt, stmt->async_mode, ret))
+
+        stmt->async_status = OCI_ASYNC_SUCCESS;
+    }
+    else if (OCI_ASYNC_CALL_FETCH == stmt->async_call)
+    {
+        /* pending fetches are driven by ResultsetFetchNextAsync() */
+
+        SET_RETVAL(OCI_ASYNC_EXECUTING)
+        JUMP_EXIT()
+    }
+
+    SET_RETVAL(stmt->async_status)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteWait
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementExecuteWait
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    unsigned int delay = OCI_ASYNC_WAIT_MIN_DELAY;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    while (OCI_ASYNC_CALL_EXECUTE == stmt->async_call)
+    {
+        CHECK(OCI_ASYNC_FAILURE != StatementExecutePoll(stmt))
+
+        if (OCI_ASYNC_CALL_EXECUTE == stmt->async_call)
+        {
+            /* do not spin while the server is still working */
+
+            ClockSleepMilliseconds(delay);
+
+            delay = min(delay * 2, OCI_ASYNC_WAIT_MAX_DELAY);
+        }
+    }
+
+    SET_RETVAL(OCI_ASYNC_SUCCESS == stmt->async_status)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StatementExecuteStmt
  * --------------------------------------------------------------------------------------------- */
@@ -1827,14 +2199,14 @@ boolean StatementDescribe
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * StatementPrepareFmt
+ * StatementPrepareFmtInternal
  * --------------------------------------------------------------------------------------------- */
 
-boolean StatementPrepareFmt
+boolean StatementPrepareFmtInternal
 (
     OCI_Statement *stmt,
     const otext   *sql,
-    va_list        args
+    va_list       *pargs
 )
 {
     ENTER_FUNC
@@ -1843,53 +2215,68 @@ boolean StatementPrepareFmt
         /* context */ OCI_IPC_STATEMENT, stmt
     )
 
+    OCI_FormatTemplate *tpl = NULL;
+
     otext* sql_fmt = NULL;
 
     va_list first_pass_args;
-    va_list second_pass_args;
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_PTR(OCI_IPC_STRING,    sql)
 
-    va_copy(first_pass_args,  args);
-    va_copy(second_pass_args, args);
-
-    /* first, get buffer size */
+    if (OCI_FAM_BIND == stmt->con->fmt_mode)
+    {
+        tpl = FormatGetTemplate(sql);
+        CHECK_NULL(tpl)
+    }
 
-    const int size = FormatParseSql(stmt, NULL, sql, &first_pass_args);
+    if (NULL != tpl && tpl->bindable)
+    {
+        /* the generated SQL is the same whatever the arguments values are */
 
-    if (size > 0)
+        CHECK(StatementPrepareInternal(stmt, tpl->sql))
+        CHECK(FormatBindArguments(stmt, tpl, pargs))
+    }
+    else
     {
+        /* first, get buffer size */
+
+        va_copy(first_pass_args, *pargs);
+
+        const int size = FormatParseSql(stmt, NULL, sql, &first_pass_args);
+
+        va_end(first_pass_args);
+
+        CHECK(size > 0)
+
         /* allocate buffer */
 
         ALLOC_DATA(OCI_IPC_STRING, sql_fmt, size + 1)
 
         /* format buffer */
 
-        if (FormatParseSql(stmt, sql_fmt, sql, &second_pass_args) > 0)
-        {
-            /* parse buffer */
+        CHECK(FormatParseSql(stmt, sql_fmt, sql, pargs) > 0)
 
-            CHECK(StatementPrepareInternal(stmt, sql_fmt))
-        }
+        /* parse buffer */
+
+        CHECK(StatementPrepareInternal(stmt, sql_fmt))
     }
 
     SET_SUCCESS()
 
     CLEANUP_AND_EXIT_FUNC
     (
-        va_end(first_pass_args);
-        va_end(second_pass_args);
+        FormatReleaseTemplate(tpl);
 
         FREE(sql_fmt)
     )
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * StatementExecuteStmtFmt
+ * StatementPrepareFmt
  * --------------------------------------------------------------------------------------------- */
 
-boolean StatementExecuteStmtFmt
+boolean StatementPrepareFmt
 (
     OCI_Statement *stmt,
     const otext   *sql,
@@ -1902,47 +2289,49 @@ boolean StatementExecuteStmtFmt
         /* context */ OCI_IPC_STATEMENT, stmt
     )
 
-    va_list first_pass_args;
-    va_list second_pass_args;
-
-    otext* sql_fmt = NULL;
-
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_PTR(OCI_IPC_STRING,    sql)
+    va_list fmt_args;
 
-    va_copy(first_pass_args,  args);
-    va_copy(second_pass_args, args);
+    va_copy(fmt_args, args);
 
-    /* first, get buffer size */
+    CHECK(StatementPrepareFmtInternal(stmt, sql, &fmt_args))
 
-    const int size = FormatParseSql(stmt, NULL, sql, &first_pass_args);
+    SET_SUCCESS()
 
-    if (size > 0)
-    {
+    CLEANUP_AND_EXIT_FUNC
+    (
+        va_end(fmt_args);
+    )
+}
 
-        /* allocate buffer */
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteStmtFmt
+ * --------------------------------------------------------------------------------------------- */
 
-        ALLOC_DATA(OCI_IPC_STRING, sql_fmt, size + 1)
+boolean StatementExecuteStmtFmt
+(
+    OCI_Statement *stmt,
+    const otext   *sql,
+    va_list        args
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
 
-        /* format buffer */
+    va_list fmt_args;
 
-        if (FormatParseSql(stmt, sql_fmt, sql, &second_pass_args) > 0)
-        {
-            /* prepare and execute SQL buffer */
+    va_copy(fmt_args, args);
 
-            CHECK(StatementPrepareInternal(stmt, sql_fmt))
-            CHECK(StatementExecuteInternal(stmt, OCI_DEFAULT))
-        }
-    }
+    CHECK(StatementPrepareFmtInternal(stmt, sql, &fmt_args))
+    CHECK(StatementExecuteInternal(stmt, OCI_DEFAULT))
 
     SET_SUCCESS()
 
     CLEANUP_AND_EXIT_FUNC
     (
-        va_end(first_pass_args);
-        va_end(second_pass_args);
-
-        FREE(sql_fmt)
+        va_end(fmt_args);
     )
 }
 
@@ -1963,46 +2352,18 @@ boolean StatementParseFmt
         /* context */ OCI_IPC_STATEMENT, stmt
     )
 
-    va_list first_pass_args;
-    va_list second_pass_args;
-
-    otext* sql_fmt = NULL;
-
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_PTR(OCI_IPC_STRING,    sql)
-
-    va_copy(first_pass_args,  args);
-    va_copy(second_pass_args, args);
+    va_list fmt_args;
 
-    /* first, get buffer size */
+    va_copy(fmt_args, args);
 
-    const int size = FormatParseSql(stmt, NULL, sql, &first_pass_args);
-
-    if (size > 0)
-    {
-        /* allocate buffer */
-
-        ALLOC_DATA(OCI_IPC_STRING, sql_fmt, size + 1)
-
-        /* format buffer */
-
-        if (FormatParseSql(stmt, sql_fmt, sql, &second_pass_args) > 0)
-        {
-            /* prepare and execute SQL buffer */
-
-            CHECK(StatementPrepareInternal(stmt, sql_fmt))
-            CHECK(StatementExecuteInternal(stmt, OCI_PARSE_ONLY))
-        }
-    }
+    CHECK(StatementPrepareFmtInternal(stmt, sql, &fmt_args))
+    CHECK(StatementExecuteInternal(stmt, OCI_PARSE_ONLY))
 
     SET_SUCCESS()
 
     CLEANUP_AND_EXIT_FUNC
     (
-        va_end(first_pass_args);
-        va_end(second_pass_args);
-
-        FREE(sql_fmt)
+        va_end(fmt_args);
     )
 }
 
@@ -2023,46 +2384,18 @@ boolean StatementDescribeFmt
         /* context */ OCI_IPC_STATEMENT, stmt
     )
 
-    va_list first_pass_args;
-    va_list second_pass_args;
+    va_list fmt_args;
 
-    otext* sql_fmt = NULL;
+    va_copy(fmt_args, args);
 
-    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
-    CHECK_PTR(OCI_IPC_STRING,    sql)
-
-    va_copy(first_pass_args,  args);
-    va_copy(second_pass_args, args);
-
-    /* first, get buffer size */
-
-    const int size = FormatParseSql(stmt, NULL, sql, &first_pass_args);
-
-    if (size > 0)
-    {
-        /* allocate buffer */
-
-        ALLOC_DATA(OCI_IPC_STRING, sql_fmt, size + 1)
-
-        /* format buffer */
-
-        if (FormatParseSql(stmt, sql_fmt, sql, &second_pass_args) > 0)
-        {
-            /* prepare and execute SQL buffer */
-
-            CHECK(StatementPrepareInternal(stmt, sql_fmt))
-            CHECK(StatementExecuteInternal(stmt, OCI_DESCRIBE_ONLY))
-        }
-    }
+    CHECK(StatementPrepareFmtInternal(stmt, sql, &fmt_args))
+    CHECK(StatementExecuteInternal(stmt, OCI_DESCRIBE_ONLY))
 
     SET_SUCCESS()
 
     CLEANUP_AND_EXIT_FUNC
     (
-        va_end(first_pass_args);
-        va_end(second_pass_args);
-
-        FREE(sql_fmt)
+        va_end(fmt_args);
     )
 }
 
@@ -2521,6 +2854,63 @@ boolean StatementBindArrayOfStrings
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementBindArrayOfPackedStrings
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementBindArrayOfPackedStrings
+(
+    OCI_Statement *stmt,
+    const otext   *name,
+    void          *data,
+    unsigned int  *offsets,
+    unsigned int   nbelem
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_Bind *bnd = NULL;
+
+    CHECK_BIND(stmt, name, data, OCI_IPC_VOID, TRUE)
+    CHECK_PTR(OCI_IPC_INT, offsets)
+
+    /* OCI needs the maximum element size, elements lengths being provided
+       one by one at execute time from the offsets array */
+
+    const unsigned int count = nbelem > 0 ? nbelem : stmt->nb_iters;
+
+    unsigned int size = 1;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (offsets[i + 1] < offsets[i])
+        {
+            THROW(ExceptionOutOfBounds, (int) i)
+        }
+
+        if (offsets[i + 1] - offsets[i] > size)
+        {
+            size = offsets[i + 1] - offsets[i];
+        }
+    }
+
+    bnd = BindCreate(stmt, data, name, OCI_BIND_INPUT, size,
+                     OCI_CDT_TEXT, SQLT_CHR, 0, NULL, nbelem);
+
+    CHECK_NULL(bnd)
+
+    bnd->offsets   = offsets;
+    bnd->direction = OCI_BDM_IN;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StatementBindRaw
  * --------------------------------------------------------------------------------------------- */
@@ -3629,7 +4019,7 @@ boolean StatementSetFetchMode
     old_exec_mode   = stmt->exec_mode;
     stmt->exec_mode = mode;
 
-    if (stmt->con->ver_num == OCI_9_0)
+    if (ConnectionGetServerNumericVersion(stmt->con) == OCI_9_0)
     {
         if (old_exec_mode == OCI_SFM_DEFAULT && stmt->exec_mode == OCI_SFM_SCROLLABLE)
         {
@@ -3800,7 +4190,7 @@ boolean StatementSetPrefetchSize
 
     /* Prefetch is not working with scrollable cursors in Oracle 9iR1, thus disable it */
 
-    if (stmt->exec_mode == OCI_SFM_SCROLLABLE && stmt->con->ver_num == OCI_9_0)
+    if (stmt->exec_mode == OCI_SFM_SCROLLABLE && ConnectionGetServerNumericVersion(stmt->con) == OCI_9_0)
     {
         stmt->prefetch_size = 0;
     }
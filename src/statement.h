@@ -65,6 +65,18 @@ boolean StatementFree
     OCI_Statement* stmt
 );
 
+OCI_Statement* StatementAcquire
+(
+    OCI_Connection* con,
+    const otext   * sql,
+    const otext   * key
+);
+
+boolean StatementRelease
+(
+    OCI_Statement* stmt
+);
+
 OCI_Resultset* StatementGetResultset
 (
     OCI_Statement* stmt
@@ -91,6 +103,21 @@ boolean StatementExecute
     OCI_Statement* stmt
 );
 
+boolean StatementExecuteAsync
+(
+    OCI_Statement* stmt
+);
+
+unsigned int StatementExecutePoll
+(
+    OCI_Statement* stmt
+);
+
+boolean StatementExecuteWait
+(
+    OCI_Statement* stmt
+);
+
 boolean StatementExecuteStmt
 (
     OCI_Statement* stmt,
@@ -109,6 +136,13 @@ boolean StatementDescribe
     const otext  * sql
 );
 
+boolean StatementPrepareFmtInternal
+(
+    OCI_Statement* stmt,
+    const otext  * sql,
+    va_list      * pargs
+);
+
 boolean StatementPrepareFmt
 (
     OCI_Statement* stmt,
@@ -288,6 +322,15 @@ boolean StatementBindArrayOfStrings
     unsigned int   nbelem
 );
 
+boolean StatementBindArrayOfPackedStrings
+(
+    OCI_Statement* stmt,
+    const otext  * name,
+    void         * data,
+    unsigned int * offsets,
+    unsigned int   nbelem
+);
+
 boolean StatementBindRaw
 (
     OCI_Statement* stmt,
@@ -167,6 +167,11 @@ OCI_Subscription * SubscriptionRegister
     CHECK_PTR(OCI_IPC_CONNECTION, con)
     CHECK_PTR(OCI_IPC_PROC,       handler)
     CHECK_PTR(OCI_IPC_STRING,     name)
+    CHECK_SYMBOLS(OCI_SYM_NOTIFY)
+
+    /* change notifications walk the OCI collections of changed tables and rows */
+
+    CHECK_SYMBOLS(OCI_SYM_COLLECTION)
 
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
@@ -22,6 +22,50 @@
 
 #include "hash.h"
 #include "macros.h"
+#include "rwlock.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * ThreadKeyLookup
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_ThreadKey * ThreadKeyLookup
+(
+    const otext *name
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_ThreadKey*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_ThreadKey *key = NULL;
+
+    boolean locked = FALSE;
+
+    /* keys are created once and looked up by any thread, so lookups only need shared access */
+
+    if (NULL != Env.key_lock)
+    {
+        CHECK(RWLockAcquireRead(Env.key_lock))
+
+        locked = TRUE;
+    }
+
+    CHECK_NULL(Env.key_map)
+
+    key = (OCI_ThreadKey*) HashGetPointer(Env.key_map, name);
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (locked)
+        {
+            RWLockReleaseRead(Env.key_lock);
+        }
+
+        SET_RETVAL(key)
+    )
+}
 
 /* --------------------------------------------------------------------------------------------- *
  * ThreadKeyCreateInternal
@@ -198,9 +242,18 @@ boolean ThreadKeyCreate
 
     OCI_ThreadKey *key = NULL;
 
+    boolean locked = FALSE;
+
     CHECK_PTR(OCI_IPC_STRING, name)
     CHECK_INITIALIZED()
 
+    if (NULL != Env.key_lock)
+    {
+        CHECK(RWLockAcquireWrite(Env.key_lock))
+
+        locked = TRUE;
+    }
+
     if (NULL == Env.key_map)
     {
         /* create the map at the first call to ThreadKeyCreate to save
@@ -223,6 +276,11 @@ boolean ThreadKeyCreate
 
     CLEANUP_AND_EXIT_FUNC
     (
+        if (locked)
+        {
+            RWLockReleaseWrite(Env.key_lock);
+        }
+
         if (FAILURE && NULL != key)
         {
             ThreadKeyFree(key);
@@ -250,7 +308,7 @@ boolean ThreadKeySetValue
 
     CHECK_PTR(OCI_IPC_STRING, name)
 
-    key = (OCI_ThreadKey*) HashGetPointer(Env.key_map, name);
+    key = ThreadKeyLookup(name);
     CHECK_NULL(key)
 
     CHECK(ThreadKeySet(key, value))
@@ -278,7 +336,7 @@ void * ThreadKeyGetValue
     OCI_ThreadKey* key = NULL;
     CHECK_PTR(OCI_IPC_STRING, name)
 
-    key = (OCI_ThreadKey*)HashGetPointer(Env.key_map, name);
+    key = ThreadKeyLookup(name);
     CHECK_NULL(key)
 
     void *data = NULL;
@@ -21,6 +21,7 @@
 #include "timestamp.h"
 
 #include "array.h"
+#include "connection.h"
 #include "environment.h"
 #include "helpers.h"
 #include "macros.h"
@@ -57,6 +58,8 @@ OCI_Timestamp * TimestampInitialize
 
 #if OCI_VERSION_COMPILE >= OCI_9_0
 
+    CHECK_SYMBOLS(OCI_SYM_TIMESTAMP)
+
     ALLOC_DATA(OCI_IPC_TIMESTAMP, tmsp, 1);
 
     tmsp->con    = con;
@@ -49,8 +49,8 @@ typedef struct OCI_MemoryBlock OCI_MemoryBlock;
  * free them if the application does not.
  *
  * @note
- * Internal lists are using mutexes for resource locking in multithreaded
- * environments
+ * Internal lists are using reader/writer locks for resource locking in
+ * multithreaded environments
  *
  */
 
@@ -62,6 +62,16 @@ struct OCI_Item
 
 typedef struct OCI_Item OCI_Item;
 
+/*
+ * OCI_RWLock : Internal reader/writer lock.
+ *
+ * Its content depends on the platform native locks and is only defined
+ * in rwlock.c
+ *
+ */
+
+typedef struct OCI_RWLock OCI_RWLock;
+
 /*
  * OCI_List : Internal list object.
  *
@@ -76,10 +86,10 @@ typedef struct OCI_Item OCI_Item;
 
 struct OCI_List
 {
-    OCI_Item  *head;     /* pointer to first item */
-    OCI_Mutex *mutex;    /* mutex handle */
-    ub4        count;    /* number of elements in list */
-    int        type;     /* type of list item */
+    OCI_Item   *head;    /* pointer to first item */
+    OCI_RWLock *lock;    /* reader/writer lock handle */
+    ub4         count;   /* number of elements in list */
+    int         type;    /* type of list item */
 };
 
 typedef struct OCI_List OCI_List;
@@ -182,6 +192,26 @@ struct OCI_ThreadKey
 
 typedef struct OCI_ThreadKey OCI_ThreadKey;
 
+#ifdef OCI_IMPORT_RUNTIME
+
+/*
+ * OCI symbol : entry of the table of OCI functions resolved at runtime
+ *
+ */
+
+typedef void (*POCI_SYMBOL)(void);
+
+struct OCI_Symbol
+{
+    const char   *name;   /* symbol name */
+    POCI_SYMBOL  *addr;   /* address of the function pointer to set */
+    unsigned int  group;  /* group of symbols resolved together */
+};
+
+typedef struct OCI_Symbol OCI_Symbol;
+
+#endif
+
 /*
  * OCI_Environment : Internal OCILIB library encapsulation.
  *
@@ -196,6 +226,8 @@ struct OCI_Environment
     OCI_List       *pools;                        /* list of pools objects */
     OCI_List       *subs;                         /* list of subscription objects */
     OCI_List       *arrs;                         /* list of arrays objects */
+    OCI_List       *routers;                      /* list of pool router objects */
+    OCI_List       *dpls;                         /* list of direct path loader objects */
     OCIError       *err;                          /* OCI error handle */
     OCIEnv         *env;                          /* OCI environment handle */
     POCI_ERROR      error_handler;                /* user defined error handler */
@@ -212,11 +244,15 @@ struct OCI_Environment
     boolean         warnings_on;                  /* warnings enabled ? */
     OCI_Error      *lib_err;                      /* Global error */
     OCI_HashTable  *key_map;                      /* hash table for mapping name/key */
+    OCI_RWLock     *key_lock;                     /* lock for name/key mapping */
     OCI_ThreadKey  *key_errs;                     /* Thread key to store thread errors */
     unsigned int    nb_hndlp;                     /* number of OCI handles allocated */
     unsigned int    nb_descp;                     /* number of OCI descriptors allocated */
     unsigned int    nb_objinst;                   /* number of OCI objects allocated */
     OCI_HashTable  *sql_funcs;                    /* hash table handle for sql function names */
+    OCI_HashTable  *fmt_tpls;                     /* hash table of parsed format templates */
+    OCI_RWLock     *fmt_lock;                     /* lock for format templates */
+    unsigned int    fmt_count;                    /* number of cached format templates */
     POCI_HA_HANDLER ha_handler;                   /* HA event callback*/
     otext          *formats[OCI_FMT_COUNT];       /* string conversion default formats */
     big_uint        mem_bytes_oci;                /* allocated bytes by OCI client */
@@ -224,8 +260,11 @@ struct OCI_Environment
     OCI_Mutex      *mem_mutex;                    /* mutex for memory counters */
     void           *usrdata;                      /* user data */
     boolean         env_vars[OCI_VARS_COUNT];     /* specific environment variables */
+    OCI_InitStatistics init_stats;                /* initialization timings */
+    OCI_Mutex      *sym_mutex;                    /* mutex for lazy symbols resolution */
 #ifdef OCI_IMPORT_RUNTIME
     LIB_HANDLE lib_handle;                        /* handle of runtime shared library */
+    boolean         sym_loaded[OCI_SYM_COUNT];    /* groups of symbols already resolved */
 #endif
 };
 
@@ -238,19 +277,68 @@ typedef struct OCI_Environment OCI_Environment;
 
 struct OCI_Pool
 {
-    void     *handle;           /* OCI pool handle */
-    void     *authp;            /* OCI authentication handle */
-    OCIError *err;              /* OCI context handle */
-    otext    *name;             /* pool name */
-    otext    *db;               /* database */
-    otext    *user;             /* user */
-    otext    *pwd;              /* password */
-    ub4       mode;             /* session mode */
-    ub4       min;              /* minimum of objects */
-    ub4       max;              /* maximum of objects */
-    ub4       incr;             /* increment step of objects */
-    ub4       htype;            /* handle type of pool : connection / session */
-    ub4       cache_size;       /* statement cache size */
+    void               *handle;           /* OCI pool handle */
+    void               *authp;            /* OCI authentication handle */
+    OCIError           *err;              /* OCI context handle */
+    otext              *name;             /* pool name */
+    otext              *db;               /* database */
+    otext              *user;             /* user */
+    otext              *pwd;              /* password */
+    ub4                 mode;             /* session mode */
+    ub4                 min;              /* minimum of objects */
+    ub4                 max;              /* maximum of objects */
+    ub4                 incr;             /* increment step of objects */
+    ub4                 htype;            /* handle type of pool : connection / session */
+    ub4                 cache_size;       /* statement cache size */
+    OCI_Mutex          *mutex;            /* protects data shared by pooled connections */
+    OCI_PoolRouter     *router;           /* pool router owning the pool */
+    otext              *ver_str;          /* cached server version string */
+    ub4                 ver_num;          /* cached numeric server version */
+    otext              *db_name;          /* cached database name */
+    otext              *service_name;     /* cached service name */
+    otext              *domain_name;      /* cached domain name */
+    OCI_PoolStatistics  stats;            /* checkout statistics */
+    ub4                 stats_opened;     /* last observed number of opened sessions */
+    ub4                 busy_peak;        /* highest busy count since last keeper run */
+    ub4                 keeper_held;      /* sessions currently held by the health keeper */
+    OCI_Thread         *keeper;           /* health keeper thread */
+    ub4                 keeper_target;    /* number of sessions to keep opened and valid */
+    ub4                 keeper_interval;  /* delay in seconds between two keeper runs */
+    ub4                 keeper_min;       /* pool minimum size set by the keeper, 0 if none */
+    volatile boolean    keeper_stop;      /* request the keeper thread to exit */
+    OCI_ThreadKey      *thread_key;       /* key holding the connection bound to each thread */
+    OCI_Connection    **thread_cons;      /* connections currently bound to threads */
+    ub4                 thread_count;     /* number of connections bound to threads */
+    ub4                 thread_alloc;     /* allocated size of thread_cons */
+};
+
+/*
+ * Pool router entry
+ *
+ */
+
+struct OCI_PoolRouterEntry
+{
+    OCI_Pool    *pool;          /* pool handle */
+    unsigned int weight;        /* pool weight */
+    big_uint     latency;       /* smoothed checkout latency in microseconds */
+    big_uint     retry_time;    /* pool is skipped until this time after a failure */
+};
+
+typedef struct OCI_PoolRouterEntry OCI_PoolRouterEntry;
+
+/*
+ * Pool router object
+ *
+ */
+
+struct OCI_PoolRouter
+{
+    OCI_PoolRouterEntry *entries;   /* array of routed pools */
+    unsigned int         count;     /* number of routed pools */
+    unsigned int         allocated; /* number of allocated entries */
+    unsigned int         backoff;   /* delay in seconds a pool is skipped after a failure */
+    OCI_Mutex           *mutex;     /* protects routing data */
 };
 
 /*
@@ -292,6 +380,18 @@ struct OCI_Connection
     otext            *domain_name;  /* server domain name */
     OCI_Timestamp    *inst_startup; /* instance startup timestamp */
     otext            *formats[OCI_FMT_COUNT];  /* string conversion default formats */
+    OCI_Statement   **prep_stmts;   /* prepared statements cache (most recently used first) */
+    unsigned int      prep_count;   /* number of statements in the prepared cache */
+    unsigned int      prep_size;    /* maximum number of statements in the prepared cache */
+    unsigned int      prep_hits;    /* number of prepared cache hits */
+    unsigned int      prep_misses;  /* number of prepared cache misses */
+    OCI_Lob         **tmp_lobs;     /* recycled temporary lobs cache */
+    unsigned int      tmp_count;    /* number of lobs in the temporary lobs cache */
+    unsigned int      tmp_size;     /* maximum number of lobs in the temporary lobs cache */
+    unsigned int      tmp_hits;     /* number of temporary lobs cache hits */
+    unsigned int      tmp_misses;   /* number of temporary lobs cache misses */
+    unsigned int      fmt_mode;     /* formatted functions arguments mode */
+    boolean           sess_drop;    /* drop the session when released to its pool */
 };
 
 /*
@@ -385,6 +485,7 @@ struct OCI_Bind
     ub1            csfrm;        /* charset form */
     ub1            direction;    /* in, out or in/out bind */
     ub1            alloc_mode;   /* allocation mode : internal or external */
+    unsigned int  *offsets;      /* elements offsets for packed strings binds */
 }
 ;
 
@@ -479,6 +580,11 @@ struct OCI_Statement
     boolean          bind_array;        /* has array binds ? */
     OCI_BatchErrors *batch;             /* error handling for array DML */
     ub2              err_pos;           /* error position in sql statement */
+    otext           *cache_key;         /* bind signature key for the prepared cache */
+    boolean          released;          /* kept by the prepared cache ? */
+    ub4              async_mode;        /* execution mode of the pending non blocking call */
+    ub1              async_call;        /* pending non blocking call */
+    ub1              async_status;      /* status of the last non blocking call */
 };
 
 /*
@@ -715,11 +821,12 @@ struct OCI_DirPathColumn
     ub2    type;                  /* column type */
     ub2    sqlcode;               /* sql type */
     ub4   *lens;                  /* array of lengths */
-    ub2    bufsize;               /* buffer size */
+    ub4    bufsize;               /* buffer size */
     ub2    index;                 /* ref index in the type info columns list */
     ub1   *data;                  /* array of data */
+    ub1  **refs;                  /* array of caller buffers set by reference */
     ub1   *flags;                 /* array of row flags */
-    ub2    maxsize;               /* input max size */
+    ub4    maxsize;               /* input max size */
 };
 
 typedef struct OCI_DirPathColumn OCI_DirPathColumn;
@@ -744,15 +851,57 @@ struct OCI_DirPath
     ub4                 status;         /* internal status */
     ub4                 nb_cur;         /* current number of row to load per stream */
     ub2                 nb_cols;        /* number of columns to load */
-    ub2                 nb_rows;        /* maximum number of row to load per stream */
+    ub4                 nb_rows;        /* maximum number of row to load per stream, 0 for automatic */
     ub2                 cvt_mode;       /* conversion mode */
     ub2                 idx_err_col;    /* index of current erred row */
     ub4                 idx_err_row;    /* index of current erred column */
     ub4                 nb_err;         /* number of conversion errors since the last load */
     unsigned int        res_conv;       /* status of the last conversion */
     unsigned int        res_load;       /* status of the last load */
+    ub4                 buf_size;       /* size of the stream transfer buffer, 0 for OCI default */
     ub4                *err_rows;       /* array of err rows index */
     ub2                *err_cols;       /* array of err col index */
+    boolean             pipelined;      /* are conversions and loads overlapped ? */
+    OCI_Thread         *pipe_thread;    /* worker thread loading the pending stream */
+    OCIDirPathStream   *pipe_strm;      /* stream loaded by the worker thread */
+    OCIError           *pipe_err;       /* error handle used by the worker thread */
+    sword               pipe_ret;       /* return code of the worker thread load */
+};
+
+/*
+ * Direct path loader worker : session converting and loading batches in its own thread
+ *
+ */
+
+struct OCI_DirPathWorker
+{
+    OCI_Connection *con;            /* worker session */
+    OCI_DirPath    *dp;             /* direct path context of the worker session */
+    OCI_Thread     *thread;         /* thread processing the submitted batch */
+    boolean         acquired;       /* is a batch being filled by the caller ? */
+    ub4             nb_loaded;      /* number of rows loaded by the waited batches */
+    ub4             nb_rejected;    /* number of rows rejected by the submitted batch */
+    boolean         failed;         /* has an error been raised by the submitted batch ? */
+    int             code;           /* code of the error raised by the submitted batch */
+};
+
+typedef struct OCI_DirPathWorker OCI_DirPathWorker;
+
+/*
+ * Direct path loader object
+ *
+ */
+
+struct OCI_DirPathLoader
+{
+    OCI_TypeInfo      *typinf;      /* type info about table to load */
+    OCI_DirPathWorker *workers;     /* array of workers */
+    unsigned int       nb_workers;  /* number of workers */
+    unsigned int       next;        /* index of the worker handing out the next batch */
+    ub4                status;      /* internal status */
+    ub4                nb_rejected; /* number of rows rejected so far */
+    ub4                nb_failed;   /* number of batches that raised an error so far */
+    int                code;        /* code of the last error raised by a batch */
 };
 
 /*
@@ -897,6 +1046,42 @@ struct OCI_HashTable
     unsigned int    type;         /* type of data */
 };
 
+/*
+ * Format template : SQL format string parsed once for bind based formatted calls
+ *
+ */
+
+struct OCI_FormatTemplate
+{
+    otext        *sql;          /* SQL text with generated bind placeholders */
+    unsigned int *args;         /* type of each format argument */
+    unsigned int  count;        /* number of format arguments */
+    boolean       bindable;     /* can format arguments be turned into binds ? */
+    boolean       cached;       /* kept by the environment until cleanup ? */
+};
+
+typedef struct OCI_FormatTemplate OCI_FormatTemplate;
+
+/*
+ * Connection batch : connections established concurrently by worker threads
+ *
+ */
+
+struct OCI_ConnectionBatch
+{
+    const otext     *db;        /* database */
+    const otext     *user;      /* user */
+    const otext     *pwd;       /* password */
+    unsigned int     mode;      /* session mode */
+    OCI_Connection **cons;      /* array of created connections */
+    int             *codes;     /* array of error codes (optional) */
+    unsigned int     count;     /* number of connections to create */
+    unsigned int     next;      /* index of the next connection to create */
+    OCI_Mutex       *mutex;     /* protects next index */
+};
+
+typedef struct OCI_ConnectionBatch OCI_ConnectionBatch;
+
 /*
  * OCI_Datatype : fake dummy structure for casting object with
  * handles for more compact code
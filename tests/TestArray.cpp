@@ -1,5 +1,7 @@
 #include "ocilib_tests.h"
 
+#include "../include/ocilib.hpp"
+
 TEST(TestArray, InsertExternalArray)
 {
     ExecDML(OTEXT("create table TestExternalArrayInsertArray(code int, name varchar2(50))"));
@@ -155,3 +157,89 @@ TEST(TestArray, InsertInternalArray)
 
     ExecDML(OTEXT("drop table TestInternalArrayInsertArray"));
 }
+
+TEST(TestArray, InsertPackedStringsArray)
+{
+    ExecDML(OTEXT("create table TestPackedStringsInsertArray(code int, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestPackedStringsInsertArray"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int tab_int[3] = { 1, 2, 3 };
+    otext data[] = OTEXT("AliceBobCharlotte");
+    unsigned int offsets[4] = { 0, 5, 8, 17 };
+
+    for (auto& offset : offsets)
+    {
+        offset *= sizeof(otext);
+    }
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestPackedStringsInsertArray values(:i, :s)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, 3));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), static_cast<int*>(tab_int), 0));
+    ASSERT_TRUE(OCI_BindArrayOfPackedStrings(stmt, OTEXT(":s"), data, offsets, 0));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(3, OCI_GetAffectedRows(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select name from TestPackedStringsInsertArray order by code")));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ostring(OTEXT("Alice")), ostring(OCI_GetString(rslt, 1)));
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ostring(OTEXT("Bob")), ostring(OCI_GetString(rslt, 1)));
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ostring(OTEXT("Charlotte")), ostring(OCI_GetString(rslt, 1)));
+    ASSERT_FALSE(OCI_FetchNext(rslt));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestPackedStringsInsertArray"));
+}
+
+TEST(TestArray, BindInPlaceRange)
+{
+    ExecDML(OTEXT("create table TestArrayBindInPlaceRange(code int)"));
+    ExecDML(OTEXT("truncate table TestArrayBindInPlaceRange"));
+
+    ocilib::Environment::Initialize();
+
+    {
+        ocilib::Connection conn(DBS, USR, PWD);
+        ocilib::Statement stmt(conn);
+
+        std::vector<int> values(ARRAY_SIZE);
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            values[i] = i + 1;
+        }
+
+        stmt.Prepare(OTEXT("insert into TestArrayBindInPlaceRange values(:i)"));
+        stmt.SetBindArraySize(ARRAY_SIZE);
+
+        /* OCI would read past the end of a range smaller than the bind array size */
+
+        ASSERT_THROW(stmt.BindInPlace(OTEXT(":i"), &values[0], ARRAY_SIZE - 1, ocilib::BindInfo::In), ocilib::Exception);
+
+        stmt.BindInPlace(OTEXT(":i"), &values[0], ARRAY_SIZE, ocilib::BindInfo::In);
+        stmt.ExecutePrepared();
+
+        ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE), stmt.GetAffectedRows());
+    }
+
+    ocilib::Environment::Cleanup();
+
+    ExecDML(OTEXT("drop table TestArrayBindInPlaceRange"));
+}
@@ -1,5 +1,7 @@
 #include "ocilib_tests.h"
 
+#include "../include/ocilib.hpp"
+
 static Context context;
 
 static inline void AddError(OCI_Error *err)
@@ -92,4 +94,222 @@ TEST(TestConnection, Abort)
     ASSERT_TRUE(OCI_StatementFree(stmt));
     ASSERT_TRUE(OCI_ConnectionFree(conn));
     ASSERT_TRUE(OCI_Cleanup());
-}
\ No newline at end of file
+}
+
+TEST(TestConnection, PreparedCache)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_EQ(20, OCI_GetPreparedCacheSize(conn));
+    ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 1));
+
+    int value = 0;
+
+    auto stmt = OCI_StatementAcquire(conn, OTEXT("select :v from dual"), OTEXT("int"));
+    ASSERT_NE(nullptr, stmt);
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":v"), &value));
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+    ASSERT_FALSE(OCI_StatementRelease(stmt));
+    ASSERT_FALSE(OCI_StatementFree(stmt));
+
+    const auto first = stmt;
+
+    stmt = OCI_StatementAcquire(conn, OTEXT("select :v from dual"), OTEXT("int"));
+    ASSERT_EQ(first, stmt);
+    ASSERT_EQ(1, OCI_GetBindCount(stmt));
+
+    value = 5;
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(5, OCI_GetInt(rslt, 1));
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+
+    stmt = OCI_StatementAcquire(conn, OTEXT("select 1 from dual"), nullptr);
+    ASSERT_NE(first, stmt);
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+
+    ASSERT_EQ(1, OCI_GetPreparedCacheHits(conn));
+    ASSERT_EQ(2, OCI_GetPreparedCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 0));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, FormatArgsBind)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_EQ(OCI_FAM_LITERAL, OCI_GetFormatArgsMode(conn));
+    ASSERT_TRUE(OCI_SetFormatArgsMode(conn, OCI_FAM_BIND));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    for (int i = 1; i <= 3; i++)
+    {
+        ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("select %i, %s from dual"), i, OTEXT("value")));
+        ASSERT_EQ(2, OCI_GetBindCount(stmt));
+        ASSERT_EQ(0, ostrcmp(OTEXT("select :1, :2 from dual"), OCI_GetSql(stmt)));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(i, OCI_GetInt(rslt, 1));
+        ASSERT_EQ(0, ostrcmp(OTEXT("value"), OCI_GetString(rslt, 2)));
+    }
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, ExecuteAsync)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, 2));
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level from dual connect by level <= 5")));
+    ASSERT_TRUE(OCI_ExecuteAsync(stmt));
+
+    unsigned int status = OCI_ASYNC_EXECUTING;
+
+    while (OCI_ASYNC_EXECUTING == status)
+    {
+        status = OCI_ExecutePoll(stmt);
+    }
+
+    ASSERT_EQ(OCI_ASYNC_SUCCESS, status);
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+
+    int count = 0;
+
+    while ((status = OCI_FetchNextAsync(rslt)) != OCI_ASYNC_FAILURE)
+    {
+        if (OCI_ASYNC_SUCCESS == status)
+        {
+            ASSERT_EQ(++count, OCI_GetInt(rslt, 1));
+        }
+    }
+
+    ASSERT_EQ(5, count);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, ExecuteAsyncFuture)
+{
+    ocilib::Environment::Initialize();
+
+    {
+        ocilib::Connection conn(DBS, USR, PWD);
+        ocilib::Statement stmt(conn);
+
+        auto result = stmt.ExecuteAsync(OTEXT("select level from dual connect by level <= 5"));
+
+        /* the future is only fulfilled by polling the statement */
+
+        while (!stmt.Poll())
+        {
+            ASSERT_EQ(std::future_status::timeout, result.wait_for(std::chrono::seconds(0)));
+        }
+
+        ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+        ASSERT_EQ(0u, result.get());
+
+        auto rslt = stmt.GetResultset();
+        int count = 0;
+
+        while (rslt++)
+        {
+            ASSERT_EQ(++count, rslt.Get<int>(1));
+        }
+
+        ASSERT_EQ(5, count);
+    }
+
+    ocilib::Environment::Cleanup();
+}
+
+TEST(TestConnection, CreateMany)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const unsigned int count = 5;
+
+    OCI_Connection* cons[count];
+    int codes[count];
+
+    ASSERT_EQ(count, OCI_ConnectionCreateMany(DBS, USR, PWD, OCI_SESSION_DEFAULT, cons, codes, count));
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        ASSERT_NE(nullptr, cons[i]);
+        ASSERT_EQ(0, codes[i]);
+        ASSERT_TRUE(OCI_IsConnected(cons[i]));
+        ASSERT_TRUE(OCI_ConnectionFree(cons[i]));
+    }
+
+    ASSERT_EQ(0u, OCI_ConnectionCreateMany(DBS, USR, OTEXT("wrong password"), OCI_SESSION_DEFAULT, cons, codes, 2));
+
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        ASSERT_EQ(nullptr, cons[i]);
+        ASSERT_EQ(1017, codes[i]);
+    }
+
+    ASSERT_EQ(nullptr, OCI_GetLastError());
+
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, InitStatisticsLazyBinding)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_LAZY_BINDING));
+
+    OCI_InitStatistics stats;
+    ASSERT_TRUE(OCI_GetInitStatistics(&stats));
+    ASSERT_GE(stats.total_time, stats.environment_time);
+    ASSERT_EQ(0u, stats.lazy_count);
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto lob = OCI_LobCreate(conn, OCI_CLOB);
+    ASSERT_NE(nullptr, lob);
+    ASSERT_TRUE(OCI_LobFree(lob));
+
+    ASSERT_TRUE(OCI_GetInitStatistics(&stats));
+
+    if (OCI_IMPORT_MODE_RUNTIME == OCI_GetImportMode())
+    {
+        ASSERT_LT(0u, stats.symbols_count);
+        ASSERT_LT(0u, stats.lazy_count);
+    }
+    else
+    {
+        ASSERT_EQ(0u, stats.lazy_count);
+    }
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
@@ -0,0 +1,546 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ocilib_tests.h"
+
+#include "../include/ocilib.hpp"
+
+#include "../src/dirpathscan.h"
+
+const size_t ScanFieldRecords = 200000;
+const size_t ScanFieldPasses = 10;
+
+class TemporaryFile
+{
+public:
+
+    explicit TemporaryFile(const char* name) : _name(name) {}
+    ~TemporaryFile() { remove(_name); }
+
+    const char* GetName() const { return _name; }
+
+private:
+
+    const char* _name;
+};
+
+static size_t ScanFieldsBytewise(const unsigned char* ptr, const unsigned char* end, unsigned char delimiter)
+{
+    size_t count = 0;
+
+    while (ptr < end)
+    {
+        while (ptr < end && delimiter != *ptr && '\n' != *ptr && '\r' != *ptr)
+        {
+            ptr++;
+        }
+
+        count++;
+        ptr++;
+    }
+
+    return count;
+}
+
+static size_t ScanFieldsWordwise(const unsigned char* ptr, const unsigned char* end, unsigned char delimiter)
+{
+    size_t count = 0;
+
+    while (ptr < end)
+    {
+        ptr = DirPathScanField(ptr, end, delimiter);
+
+        count++;
+        ptr++;
+    }
+
+    return count;
+}
+
+TEST(TestDirPath, ScanFieldBenchmark)
+{
+    std::string content;
+
+    for (size_t i = 0; i < ScanFieldRecords; i++)
+    {
+        content += std::to_string(i) + ",Name of the record number " + std::to_string(i) + ",,2020-01-01 00:00:00\r\n";
+    }
+
+    const auto begin = reinterpret_cast<const unsigned char*>(content.data());
+    const auto end = begin + content.size();
+
+    size_t bytewiseCount = 0;
+    size_t wordwiseCount = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < ScanFieldPasses; i++)
+    {
+        bytewiseCount = ScanFieldsBytewise(begin, end, ',');
+    }
+
+    const std::chrono::duration<double, std::milli> bytewiseTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < ScanFieldPasses; i++)
+    {
+        wordwiseCount = ScanFieldsWordwise(begin, end, ',');
+    }
+
+    const std::chrono::duration<double, std::milli> wordwiseTime = std::chrono::steady_clock::now() - start;
+
+    /* each record has 4 fields and an empty one between CR and LF */
+
+    ASSERT_EQ(ScanFieldRecords * 5, bytewiseCount);
+    ASSERT_EQ(bytewiseCount, wordwiseCount);
+
+    std::cout << "[ SCANFIELD ] " << ScanFieldPasses << " passes x " << content.size() << " bytes : "
+              << "bytewise " << bytewiseTime.count() << " ms, wordwise " << wordwiseTime.count() << " ms" << std::endl;
+}
+
+TEST(TestDirPath, SetEntryByRef)
+{
+    ExecDML(OTEXT("create table TestDirPathSetEntryByRef(code raw(4), name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathSetEntryByRef"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto typinf = OCI_TypeInfoGet(conn, OTEXT("TestDirPathSetEntryByRef"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, typinf);
+
+    const auto dp = OCI_DirPathCreate(typinf, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("code"), 4, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("name"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    /* caller owned buffers that must stay valid until the rows are converted */
+
+    std::array<unsigned int, ARRAY_SIZE> codes;
+    std::array<ostring, ARRAY_SIZE> names;
+
+    for (unsigned int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        names[i] = OTEXT("Name ") + TO_STRING(i + 1);
+
+        ASSERT_TRUE(OCI_DirPathSetEntryByRef(dp, i + 1, 1, &codes[i], sizeof(codes[i]), TRUE));
+        ASSERT_TRUE(OCI_DirPathSetEntryByRef(dp, i + 1, 2, names[i].data(), static_cast<unsigned int>(names[i].size() * sizeof(otext)), TRUE));
+    }
+
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+
+    ASSERT_EQ(ARRAY_SIZE, OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select name from TestDirPathSetEntryByRef order by name")));
+
+    auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+
+    unsigned int count = 0;
+    while (OCI_FetchNext(rslt))
+    {
+        count++;
+    }
+
+    ASSERT_EQ(ARRAY_SIZE, count);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathSetEntryByRef"));
+}
+
+TEST(TestDirPath, SetEntries)
+{
+    ExecDML(OTEXT("create table TestDirPathSetEntries(code number, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathSetEntries"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto typinf = OCI_TypeInfoGet(conn, OTEXT("TestDirPathSetEntries"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, typinf);
+
+    const auto dp = OCI_DirPathCreate(typinf, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("code"), 10, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("name"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    otext codes[ARRAY_SIZE][STRING_SIZE + 1] = {};
+    otext names[ARRAY_SIZE][STRING_SIZE + 1] = {};
+    boolean nulls[ARRAY_SIZE] = {};
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        osprintf(codes[i], STRING_SIZE, OTEXT("%d"), i + 1);
+        osprintf(names[i], STRING_SIZE, OTEXT("Name %d"), i + 1);
+
+        nulls[i] = (i % 2) == 0;
+    }
+
+    ASSERT_TRUE(OCI_DirPathSetEntries(dp, 1, 1, ARRAY_SIZE, codes, sizeof(codes[0]), nullptr, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetEntries(dp, 1, 2, ARRAY_SIZE, names, sizeof(names[0]), nullptr, nulls));
+
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+
+    ASSERT_EQ(ARRAY_SIZE, OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select code, name from TestDirPathSetEntries order by code")));
+
+    auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+
+    int count = 0;
+    while (OCI_FetchNext(rslt))
+    {
+        count++;
+        ASSERT_EQ(count, OCI_GetInt(rslt, 1));
+        ASSERT_EQ((count % 2) == 1, OCI_IsNull(rslt, 2) == TRUE);
+    }
+
+    ASSERT_EQ(ARRAY_SIZE, count);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathSetEntries"));
+}
+
+TEST(TestDirPath, PipelinedLoad)
+{
+    const int nbLoads = 3;
+
+    ExecDML(OTEXT("create table TestDirPathPipelinedLoad(code number, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathPipelinedLoad"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto typinf = OCI_TypeInfoGet(conn, OTEXT("TestDirPathPipelinedLoad"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, typinf);
+
+    const auto dp = OCI_DirPathCreate(typinf, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetPipelined(dp, TRUE));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("code"), 10, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("name"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    otext codes[ARRAY_SIZE][STRING_SIZE + 1] = {};
+    otext names[ARRAY_SIZE][STRING_SIZE + 1] = {};
+
+    for (int i = 0; i < nbLoads; i++)
+    {
+        ASSERT_TRUE(OCI_DirPathReset(dp));
+
+        for (int j = 0; j < ARRAY_SIZE; j++)
+        {
+            osprintf(codes[j], STRING_SIZE, OTEXT("%d"), i * ARRAY_SIZE + j + 1);
+            osprintf(names[j], STRING_SIZE, OTEXT("Name %d"), i * ARRAY_SIZE + j + 1);
+        }
+
+        ASSERT_TRUE(OCI_DirPathSetEntries(dp, 1, 1, ARRAY_SIZE, codes, sizeof(codes[0]), nullptr, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetEntries(dp, 1, 2, ARRAY_SIZE, names, sizeof(names[0]), nullptr, nullptr));
+
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    }
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+
+    ASSERT_EQ(nbLoads * ARRAY_SIZE, OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestDirPathPipelinedLoad")));
+
+    auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(nbLoads * ARRAY_SIZE, OCI_GetInt(rslt, 1));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathPipelinedLoad"));
+}
+
+TEST(TestDirPath, LoaderParallelLoad)
+{
+    const int nbWorkers = 3;
+    const int nbBatches = 6;
+
+    ExecDML(OTEXT("create table TestDirPathLoader(code number, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathLoader"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto typinf = OCI_TypeInfoGet(conn, OTEXT("TestDirPathLoader"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, typinf);
+
+    const auto dpl = OCI_DirPathLoaderCreate(typinf, nullptr, 2, ARRAY_SIZE, nbWorkers);
+    ASSERT_NE(nullptr, dpl);
+    ASSERT_EQ(nbWorkers, OCI_DirPathLoaderGetWorkerCount(dpl));
+
+    ASSERT_TRUE(OCI_DirPathLoaderSetColumn(dpl, 1, OTEXT("code"), 10, nullptr));
+    ASSERT_TRUE(OCI_DirPathLoaderSetColumn(dpl, 2, OTEXT("name"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathLoaderPrepare(dpl));
+
+    otext codes[ARRAY_SIZE][STRING_SIZE + 1] = {};
+    otext names[ARRAY_SIZE][STRING_SIZE + 1] = {};
+
+    for (int i = 0; i < nbBatches; i++)
+    {
+        const auto dp = OCI_DirPathLoaderGetBatch(dpl);
+        ASSERT_NE(nullptr, dp);
+
+        for (int j = 0; j < ARRAY_SIZE; j++)
+        {
+            osprintf(codes[j], STRING_SIZE, OTEXT("%d"), i * ARRAY_SIZE + j + 1);
+            osprintf(names[j], STRING_SIZE, OTEXT("Name %d"), i * ARRAY_SIZE + j + 1);
+        }
+
+        ASSERT_TRUE(OCI_DirPathSetEntries(dp, 1, 1, ARRAY_SIZE, codes, sizeof(codes[0]), nullptr, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetEntries(dp, 1, 2, ARRAY_SIZE, names, sizeof(names[0]), nullptr, nullptr));
+
+        ASSERT_TRUE(OCI_DirPathLoaderSubmit(dpl, dp));
+    }
+
+    ASSERT_TRUE(OCI_DirPathLoaderFinish(dpl));
+
+    ASSERT_EQ(nbBatches * ARRAY_SIZE, OCI_DirPathLoaderGetRowCount(dpl));
+    ASSERT_EQ(0, OCI_DirPathLoaderGetRejectedCount(dpl));
+    ASSERT_EQ(0, OCI_DirPathLoaderGetErrorCount(dpl));
+    ASSERT_EQ(0, OCI_DirPathLoaderGetErrorCode(dpl));
+
+    ASSERT_TRUE(OCI_DirPathLoaderFree(dpl));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestDirPathLoader")));
+
+    auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(nbBatches * ARRAY_SIZE, OCI_GetInt(rslt, 1));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathLoader"));
+}
+
+TEST(TestDirPath, LoadFile)
+{
+    ExecDML(OTEXT("create table TestDirPathLoadFile(code number, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathLoadFile"));
+
+    /* header, quoted fields with delimiters and doubled quotes, null values and CRLF line ends */
+
+    const TemporaryFile csv("TestDirPathLoadFile.csv");
+
+    const auto file = fopen(csv.GetName(), "wb");
+    ASSERT_NE(nullptr, file);
+
+    fputs("code,name\r\n", file);
+
+    for (int i = 0; i < ARRAY_SIZE * 2 + 3; i++)
+    {
+        fprintf(file, "%d,\"Name \"\"%d\"\", the one\"\r\n", i + 1, i + 1);
+    }
+
+    fputs("\r\n", file);
+    fputs("0,\n", file);
+
+    ASSERT_EQ(0, fclose(file));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto typinf = OCI_TypeInfoGet(conn, OTEXT("TestDirPathLoadFile"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, typinf);
+
+    const auto dp = OCI_DirPathCreate(typinf, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("code"), 10, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("name"), STRING_SIZE * 2, nullptr));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    ASSERT_FALSE(OCI_DirPathLoadFile(dp, OTEXT("TestDirPathLoadFileMissing.csv"), OTEXT(','), OTEXT('"'), 1));
+    ASSERT_TRUE(OCI_DirPathLoadFile(dp, OTEXT("TestDirPathLoadFile.csv"), OTEXT(','), OTEXT('"'), 1));
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+
+    ASSERT_EQ(ARRAY_SIZE * 2 + 4, OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select name from TestDirPathLoadFile where code = 3")));
+
+    auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ostring(OTEXT("Name \"3\", the one")), ostring(OCI_GetString(rslt, 1)));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestDirPathLoadFile where name is null")));
+
+    rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(1, OCI_GetInt(rslt, 1));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathLoadFile"));
+}
+
+TEST(TestDirPath, AutomaticSizing)
+{
+    ExecDML(OTEXT("create table TestDirPathAutomaticSizing(code number, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathAutomaticSizing"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto typinf = OCI_TypeInfoGet(conn, OTEXT("TestDirPathAutomaticSizing"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, typinf);
+
+    /* no rows count given : it is derived from the buffer size and the columns size */
+
+    const auto dp = OCI_DirPathCreate(typinf, nullptr, 2, 0);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("code"), 10, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("name"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetBufferSize(dp, 256 * 1024));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    const auto nbRows = OCI_DirPathGetMaxRows(dp);
+    ASSERT_GT(nbRows, static_cast<unsigned int>(ARRAY_SIZE));
+
+    ASSERT_TRUE(OCI_DirPathSetCurrentRows(dp, ARRAY_SIZE));
+
+    for (unsigned int i = 0; i < ARRAY_SIZE; i++)
+    {
+        const auto code = TO_STRING(i + 1);
+        const auto name = OTEXT("Name ") + code;
+
+        ASSERT_TRUE(OCI_DirPathSetEntry(dp, i + 1, 1, (void*)code.c_str(), static_cast<unsigned int>(code.size()), TRUE));
+        ASSERT_TRUE(OCI_DirPathSetEntry(dp, i + 1, 2, (void*)name.c_str(), static_cast<unsigned int>(name.size()), TRUE));
+    }
+
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+
+    ASSERT_EQ(ARRAY_SIZE, OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathAutomaticSizing"));
+}
+
+TEST(TestDirPath, SetEntriesVectors)
+{
+    ExecDML(OTEXT("create table TestDirPathSetEntriesVectors(code number, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestDirPathSetEntriesVectors"));
+
+    ocilib::Environment::Initialize();
+
+    {
+        ocilib::Connection conn(DBS, USR, PWD);
+        ocilib::TypeInfo typeInfo(conn, OTEXT("TestDirPathSetEntriesVectors"), ocilib::TypeInfo::Table);
+        ocilib::DirectPath directPath(typeInfo, 2, ARRAY_SIZE);
+
+        directPath.SetColumn(1, OTEXT("code"), 10);
+        directPath.SetColumn(2, OTEXT("name"), STRING_SIZE);
+        directPath.Prepare();
+
+        std::vector<ostring> codes;
+        std::vector<ostring> names;
+        std::vector<bool> nulls;
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            codes.push_back(TO_STRING(i + 1));
+            names.push_back(OTEXT("Name ") + TO_STRING(i + 1));
+            nulls.push_back(i % 2 == 0);
+        }
+
+        /* values of various lengths are packed into a single buffer */
+
+        directPath.SetEntries(1, 1, codes);
+        directPath.SetEntries(1, 2, names, nulls);
+
+        ASSERT_EQ(ocilib::DirectPath::ResultComplete, directPath.Convert());
+        ASSERT_EQ(ocilib::DirectPath::ResultComplete, directPath.Load());
+        directPath.Finish();
+
+        ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE), directPath.GetRowCount());
+
+        ocilib::Statement stmt(conn);
+        stmt.Execute(OTEXT("select count(*), count(name), max(code) from TestDirPathSetEntriesVectors where name is null or name = 'Name ' || code"));
+
+        auto rslt = stmt.GetResultset();
+        ASSERT_TRUE(rslt.Next());
+        ASSERT_EQ(ARRAY_SIZE, rslt.Get<int>(1));
+        ASSERT_EQ(ARRAY_SIZE / 2, rslt.Get<int>(2));
+        ASSERT_EQ(ARRAY_SIZE, rslt.Get<int>(3));
+    }
+
+    ocilib::Environment::Cleanup();
+
+    ExecDML(OTEXT("drop table TestDirPathSetEntriesVectors"));
+}
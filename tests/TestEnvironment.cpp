@@ -0,0 +1,138 @@
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "ocilib_tests.h"
+
+#include "../include/ocilib.hpp"
+
+const size_t RegistryThreads = 8;
+const size_t RegistryOperations = 100000;
+
+template<class M>
+static double RunRegistryBenchmark(M& map)
+{
+    std::array<std::thread, RegistryThreads> threads;
+    std::array<std::vector<char>, RegistryThreads> keys;
+
+    for (auto& k : keys)
+    {
+        k.resize(RegistryOperations);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < RegistryThreads; i++)
+    {
+        threads[i] = std::thread([&map, &keys, i]()
+        {
+            auto& k = keys[i];
+
+            for (size_t j = 0; j < RegistryOperations; j++)
+            {
+                const auto key = static_cast<ocilib::AnyPointer>(&k[j]);
+                const auto value = reinterpret_cast<ocilib::core::Handle*>(&k[j]);
+
+                map.Set(key, value);
+                ASSERT_EQ(value, map.Get(key));
+                map.Remove(key);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+TEST(TestEnvironment, HandleRegistryConcurrentAccess)
+{
+    ocilib::Environment::Initialize(ocilib::Environment::Threaded);
+
+    double singleLockTime = 0;
+    double shardedTime = 0;
+
+    {
+        ocilib::core::Locker locker;
+        locker.SetAccessMode(true);
+
+        ocilib::core::ConcurrentMap<ocilib::AnyPointer, ocilib::core::Handle*> map;
+        map.SetLocker(&locker);
+
+        singleLockTime = RunRegistryBenchmark(map);
+        ASSERT_EQ(0u, map.GetSize());
+
+        map.SetLocker(nullptr);
+    }
+
+    {
+        ocilib::core::ConcurrentHashMap<ocilib::AnyPointer, ocilib::core::Handle*> map;
+        map.SetAccessMode(true);
+
+        shardedTime = RunRegistryBenchmark(map);
+        ASSERT_EQ(0u, map.GetSize());
+
+        map.SetAccessMode(false);
+    }
+
+    std::cout << "[ REGISTRY ] " << RegistryThreads << " threads x " << RegistryOperations << " set/get/remove : "
+              << "single lock map " << singleLockTime << " ms, sharded hash map " << shardedTime << " ms" << std::endl;
+
+    ocilib::Environment::Cleanup();
+}
+
+class RegistryTestHandle : public ocilib::core::Handle
+{
+public:
+
+    ocilib::core::HandleList& GetChildren() override { return _children; }
+    void DetachFromHolders() override {}
+    void DetachFromParent() override {}
+
+private:
+
+    ocilib::core::HandleList _children;
+};
+
+TEST(TestEnvironment, HandleListAttachDetachRelease)
+{
+    const size_t count = 10000;
+
+    std::vector<RegistryTestHandle> handles(count);
+
+    ocilib::core::HandleList list;
+
+    for (auto& handle : handles)
+    {
+        list.Add(&handle);
+    }
+
+    ASSERT_EQ(count, list.GetSize());
+
+    for (size_t i = 0; i < count; i += 2)
+    {
+        list.Remove(&handles[i]);
+    }
+
+    list.Remove(&handles[0]);
+
+    ASSERT_EQ(count / 2, list.GetSize());
+
+    size_t released = 0;
+
+    list.Release([&list, &released](ocilib::core::Handle* handle)
+    {
+        list.Remove(handle);
+        released++;
+    });
+
+    ASSERT_EQ(count / 2, released);
+    ASSERT_EQ(0u, list.GetSize());
+}
@@ -1,5 +1,7 @@
 #include "ocilib_tests.h"
 
+#include "../include/ocilib.hpp"
+
 class TestLob : public ::testing::TestWithParam<unsigned int> {};
 
 std::vector<unsigned int> LobTypes{ OCI_BLOB, OCI_CLOB, OCI_NCLOB };
@@ -181,5 +183,292 @@ TEST_P(TestLob, Truncate)
     ASSERT_TRUE(OCI_Cleanup());
 }
 
+TEST_P(TestLob, ArrayWrite)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    auto type = GetParam();
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    const auto lobs = OCI_LobArrayCreate(conn, type, ARRAY_SIZE);
+    ASSERT_TRUE(nullptr != lobs);
+
+    void* buffers[ARRAY_SIZE] = {};
+    unsigned int sizes[ARRAY_SIZE] = {};
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        buffers[i] = GetBufferData();
+        sizes[i] = GetBufferSize(type);
+    }
+
+    ASSERT_TRUE(OCI_LobArrayWrite(lobs, ARRAY_SIZE, buffers, sizes));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        ASSERT_EQ(GetBufferSize(type), sizes[i]);
+        ASSERT_EQ(GetBufferSize(type), OCI_LobGetLength(lobs[i]));
+        ASSERT_EQ(GetBufferSize(type), OCI_LobGetOffset(lobs[i]));
+    }
+
+    ASSERT_TRUE(OCI_LobArrayFree(lobs));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST_P(TestLob, TemporaryLobCache)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    auto type = GetParam();
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_EQ(0, OCI_GetTemporaryLobCacheSize(conn));
+    ASSERT_TRUE(OCI_SetTemporaryLobCacheSize(conn, 2));
+    ASSERT_EQ(2, OCI_GetTemporaryLobCacheSize(conn));
+
+    auto lob = OCI_LobCreate(conn, type);
+    ASSERT_NE(nullptr, lob);
+    ASSERT_EQ(0, OCI_GetTemporaryLobCacheHits(conn));
+    ASSERT_EQ(1, OCI_GetTemporaryLobCacheMisses(conn));
+
+    ASSERT_EQ(GetBufferSize(type), OCI_LobWrite(lob, GetBufferData(), GetBufferSize(type)));
+    ASSERT_TRUE(OCI_LobFree(lob));
+
+    /* the freed lob is handed back empty */
+
+    lob = OCI_LobCreate(conn, type);
+    ASSERT_NE(nullptr, lob);
+    ASSERT_EQ(1, OCI_GetTemporaryLobCacheHits(conn));
+    ASSERT_EQ(1, OCI_GetTemporaryLobCacheMisses(conn));
+    ASSERT_EQ(0, OCI_LobGetLength(lob));
+    ASSERT_EQ(0, OCI_LobGetOffset(lob));
+
+    ASSERT_TRUE(OCI_LobFree(lob));
+    ASSERT_TRUE(OCI_SetTemporaryLobCacheSize(conn, 0));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+struct DownloadProgressState
+{
+    big_uint done = 0;
+    unsigned int calls = 0;
+    unsigned int failures = 0;
+};
+
+static void DownloadProgress(void* ctx, big_uint done, big_uint total)
+{
+    auto state = static_cast<DownloadProgressState*>(ctx);
+
+    /* assertions would only return from the callback, so failures are checked by the test */
+
+    if (done <= state->done || done > total)
+    {
+        state->failures++;
+    }
+
+    state->done = done;
+    state->calls++;
+}
+
+TEST(TestLobDownload, DownloadToFile)
+{
+    const unsigned int size = 3 * 1024 * 1024 + 17;
+
+    ExecDML(OTEXT("create table TestLobDownload(code number, data blob)"));
+    ExecDML(OTEXT("delete from TestLobDownload"));
+    ExecDML(OTEXT("insert into TestLobDownload values(1, empty_blob())"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select data from TestLobDownload where code = 1 for update")));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+
+    std::vector<unsigned char> content(size);
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        content[i] = static_cast<unsigned char>(i % 251);
+    }
+
+    ASSERT_EQ(size, OCI_LobWrite(OCI_GetLob(rslt, 1), content.data(), size));
+    ASSERT_TRUE(OCI_Commit(conn));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+
+    const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 4, 1);
+    ASSERT_NE(nullptr, pool);
+
+    DownloadProgressState progress;
+
+    ASSERT_TRUE(OCI_LobDownload(pool, OTEXT("select data from TestLobDownload where code = 1"),
+                                OTEXT("TestLobDownload.bin"), 4, DownloadProgress, &progress));
+
+    ASSERT_GT(progress.calls, 0u);
+    ASSERT_EQ(0u, progress.failures);
+    ASSERT_EQ(static_cast<big_uint>(size), progress.done);
+
+    ASSERT_TRUE(OCI_PoolFree(pool));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    const auto file = fopen("TestLobDownload.bin", "rb");
+    ASSERT_NE(nullptr, file);
+
+    std::vector<unsigned char> downloaded(size + 1);
+    ASSERT_EQ(size, fread(downloaded.data(), 1, downloaded.size(), file));
+    ASSERT_EQ(0, fclose(file));
+
+    downloaded.resize(size);
+    ASSERT_EQ(content, downloaded);
+
+    remove("TestLobDownload.bin");
+
+    ExecDML(OTEXT("drop table TestLobDownload"));
+}
+
+TEST(TestLobStream, ReadIntoBufferAndStreams)
+{
+    ocilib::Environment::Initialize();
+
+    {
+        ocilib::Connection conn(DBS, USR, PWD);
+        ocilib::Clob lob(conn);
+
+        /* small chunks force several round trips */
+
+        {
+            ocilib::ClobOutputStream output(lob, 1);
+
+            for (int i = 0; i < ARRAY_SIZE; i++)
+            {
+                output << OTEXT("Line ") << i + 1 << std::endl;
+            }
+        }
+
+        ASSERT_TRUE(lob.GetLength() > 0);
+
+        lob.Seek(ocilib::SeekSet, 0);
+
+        ocilib::ClobInputStream input(lob, 1);
+        ostring line;
+        int count = 0;
+
+        while (std::getline(input, line))
+        {
+            count++;
+            ASSERT_EQ(ostring(OTEXT("Line ")) + TO_STRING(count), line);
+        }
+
+        ASSERT_EQ(ARRAY_SIZE, count);
+
+        lob.Seek(ocilib::SeekSet, 0);
+
+        otext buffer[64] = {};
+        ASSERT_TRUE(lob.Read(buffer, sizeof(buffer) / sizeof(otext)) > 6);
+        ASSERT_EQ(ostring(OTEXT("Line 1")), ostring(buffer, 6));
+
+        ostring content(OTEXT("Head"));
+        lob.Seek(ocilib::SeekSet, 4);
+        ASSERT_EQ(2u, lob.Read(content, 2));
+        ASSERT_EQ(ostring(OTEXT("Head 1")), content);
+    }
+
+    ocilib::Environment::Cleanup();
+}
+
+TEST(TestLobStream, WriteMultibyteText)
+{
+    ocilib::Environment::Initialize();
+
+    /* only relevant for a UTF8 client charset */
+
+    if (sizeof(otext) == 1 && ocilib::Environment::GetCharMaxSize() > 1)
+    {
+        ocilib::Connection conn(DBS, USR, PWD);
+        ocilib::Clob lob(conn);
+
+        /* a leading single byte character shifts the 3 bytes sequences so that
+           the stream buffer boundaries fall in their middle */
+
+        const unsigned int count = static_cast<unsigned int>(lob.GetChunkSize()) * 3;
+
+        ostring content(OTEXT("a"));
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            content += OTEXT("\xE2\x82\xAC");
+        }
+
+        {
+            ocilib::ClobOutputStream output(lob);
+
+            output << content;
+        }
+
+        ASSERT_EQ(static_cast<big_uint>(count + 1), lob.GetLength());
+
+        lob.Seek(ocilib::SeekSet, 0);
+
+        ASSERT_EQ(content, lob.Read(count + 1));
+    }
+
+    ocilib::Environment::Cleanup();
+}
+
+TEST(TestLobWriteMany, WriteMany)
+{
+    ocilib::Environment::Initialize();
+
+    {
+        ocilib::Connection conn(DBS, USR, PWD);
+
+        std::vector<ocilib::Clob> lobs;
+        std::vector<ostring> contents;
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            lobs.emplace_back(conn);
+            contents.emplace_back(OTEXT("Lob ") + TO_STRING(i + 1));
+        }
+
+        /* empty contents are not written, as with Write(), and contents in excess are ignored */
+
+        contents[ARRAY_SIZE / 2].clear();
+        contents.emplace_back(OTEXT("Ignored"));
+
+        const auto sizes = ocilib::Clob::WriteMany(lobs, contents);
+        ASSERT_EQ(static_cast<size_t>(ARRAY_SIZE), sizes.size());
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            ASSERT_EQ(static_cast<unsigned int>(contents[i].size()), sizes[i]);
+            ASSERT_EQ(static_cast<big_uint>(contents[i].size()), lobs[i].GetLength());
+
+            if (!contents[i].empty())
+            {
+                lobs[i].Seek(ocilib::SeekSet, 0);
+                ASSERT_EQ(contents[i], lobs[i].Read(sizes[i]));
+            }
+        }
+
+        ASSERT_TRUE(ocilib::Clob::WriteMany(lobs, std::vector<ostring>()).empty());
+    }
+
+    ocilib::Environment::Cleanup();
+}
 
 INSTANTIATE_TEST_CASE_P(TestLob, TestLob, ::testing::ValuesIn(LobTypes));
@@ -1,4 +1,6 @@
 #include <atomic>
+#include <chrono>
+#include <thread>
 
 #include "ocilib_tests.h"
 
@@ -47,3 +49,167 @@ TEST(TestPool, SessionPoolGetMultipleConnections)
 
     ASSERT_EQ(MaxThread, ConnCreatedCount);
 }
+
+TEST(TestPool, SessionPoolSharedServerMetadata)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 2, 1);
+    ASSERT_NE(nullptr, pool);
+
+    const auto conn1 = OCI_PoolGetConnection(pool, nullptr);
+    ASSERT_NE(nullptr, conn1);
+
+    const ostring version = OCI_GetVersionServer(conn1);
+    ASSERT_FALSE(version.empty());
+
+    const auto conn2 = OCI_PoolGetConnection(pool, nullptr);
+    ASSERT_NE(nullptr, conn2);
+
+    ASSERT_EQ(version, ostring(OCI_GetVersionServer(conn2)));
+    ASSERT_EQ(OCI_GetServerMajorVersion(conn1), OCI_GetServerMajorVersion(conn2));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn2));
+    ASSERT_TRUE(OCI_ConnectionFree(conn1));
+    ASSERT_TRUE(OCI_PoolFree(pool));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestPool, SessionPoolStatistics)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 2, 1);
+    ASSERT_NE(nullptr, pool);
+
+    const auto conn1 = OCI_PoolGetConnection(pool, nullptr);
+    ASSERT_NE(nullptr, conn1);
+
+    const auto conn2 = OCI_PoolGetConnection(pool, OTEXT("TAG_STATS"));
+    ASSERT_NE(nullptr, conn2);
+
+    OCI_PoolStatistics stats;
+    ASSERT_TRUE(OCI_PoolGetStatistics(pool, &stats));
+
+    ASSERT_EQ(2, stats.checkouts);
+    ASSERT_EQ(0, stats.failures);
+    ASSERT_EQ(1, stats.tag_hits + stats.tag_misses);
+    ASSERT_EQ(2, stats.sessions_created);
+
+    big_uint total = 0;
+    for (auto count : stats.latency_histogram)
+    {
+        total += count;
+    }
+    ASSERT_EQ(2, total);
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn2));
+    ASSERT_TRUE(OCI_ConnectionFree(conn1));
+
+    ASSERT_TRUE(OCI_PoolResetStatistics(pool));
+    ASSERT_TRUE(OCI_PoolGetStatistics(pool, &stats));
+    ASSERT_EQ(0, stats.checkouts);
+
+    ASSERT_TRUE(OCI_PoolFree(pool));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestPool, SessionPoolKeeperWarmUp)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 4, 1);
+    ASSERT_NE(nullptr, pool);
+
+    ASSERT_TRUE(OCI_PoolStartKeeper(pool, 3, 1));
+
+    for (int i = 0; i < 50 && OCI_PoolGetOpenedCount(pool) < 3; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    ASSERT_LE(3, OCI_PoolGetOpenedCount(pool));
+
+    ASSERT_TRUE(OCI_PoolStopKeeper(pool));
+    ASSERT_TRUE(OCI_PoolFree(pool));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestPool, PoolRouterGetConnection)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto router = OCI_PoolRouterCreate();
+    ASSERT_NE(nullptr, router);
+
+    ASSERT_TRUE(OCI_PoolRouterAddPool(router, OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 2, 1), 1));
+    ASSERT_TRUE(OCI_PoolRouterAddPool(router, OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 2, 1), 1));
+    ASSERT_EQ(2, OCI_PoolRouterGetCount(router));
+
+    const auto conn1 = OCI_PoolRouterGetConnection(router, nullptr);
+    ASSERT_NE(nullptr, conn1);
+
+    const auto conn2 = OCI_PoolRouterGetConnection(router, nullptr);
+    ASSERT_NE(nullptr, conn2);
+
+    ASSERT_EQ(1, OCI_PoolGetBusyCount(OCI_PoolRouterGetPool(router, 1)));
+    ASSERT_EQ(1, OCI_PoolGetBusyCount(OCI_PoolRouterGetPool(router, 2)));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn2));
+    ASSERT_TRUE(OCI_ConnectionFree(conn1));
+    ASSERT_TRUE(OCI_PoolRouterFree(router));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+static void ThreadConnectionWorkerProc(OCI_Thread* thread, void* data)
+{
+    const auto pool = static_cast<OCI_Pool*>(data);
+
+    const auto conn1 = OCI_PoolGetThreadConnection(pool);
+    ASSERT_NE(nullptr, conn1);
+
+    const auto conn2 = OCI_PoolGetThreadConnection(pool);
+    ASSERT_EQ(conn1, conn2);
+
+    int anwser = 0;
+    OCI_Immediate(conn2, OTEXT("select 42 from dual"), OCI_ARG_INT, &anwser);
+    ASSERT_EQ(42, anwser);
+}
+
+TEST(TestPool, SessionPoolThreadConnection)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto pool = OCI_PoolCreate(DBS, USR, PWD, OCI_POOL_SESSION, OCI_SESSION_DEFAULT, 0, 10, 1);
+    ASSERT_NE(nullptr, pool);
+
+    std::array<OCI_Thread*, MaxThread> threads{};
+
+    for (auto& thread : threads)
+    {
+        thread = OCI_ThreadCreate();
+        ASSERT_NE(nullptr, thread);
+        ASSERT_TRUE(OCI_ThreadRun(thread, ThreadConnectionWorkerProc, pool));
+    }
+
+    for (auto& thread : threads)
+    {
+        ASSERT_TRUE(OCI_ThreadJoin(thread));
+        ASSERT_TRUE(OCI_ThreadFree(thread));
+    }
+
+    /* connections are returned to the pool when their thread exits */
+
+    ASSERT_EQ(0u, OCI_PoolGetBusyCount(pool));
+
+    const auto conn = OCI_PoolGetThreadConnection(pool);
+    ASSERT_NE(nullptr, conn);
+    ASSERT_EQ(conn, OCI_PoolGetThreadConnection(pool));
+    ASSERT_EQ(1u, OCI_PoolGetBusyCount(pool));
+
+    ASSERT_TRUE(OCI_PoolReleaseThreadConnection(pool));
+    ASSERT_EQ(0u, OCI_PoolGetBusyCount(pool));
+
+    ASSERT_TRUE(OCI_PoolFree(pool));
+    ASSERT_TRUE(OCI_Cleanup());
+}